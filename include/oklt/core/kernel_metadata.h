@@ -2,7 +2,9 @@
 
 #include <nlohmann/json.hpp>
 
+#include <cstdint>
 #include <list>
+#include <map>
 #include <optional>
 #include <string>
 #include <vector>
@@ -116,12 +118,165 @@ enum class UnOp {
     Other     ///< Other unary operation.
 };
 
+/**
+ * @brief Enum for the OpenMP loop schedule kinds.
+ */
+enum class ScheduleKind {
+    Default,  ///< No schedule clause, implementation defined.
+    Static,   ///< schedule(static).
+    Dynamic,  ///< schedule(dynamic).
+    Guided,   ///< schedule(guided).
+    Auto,     ///< schedule(auto).
+    Runtime,  ///< schedule(runtime), taken from OMP_SCHEDULE.
+};
+
+/**
+ * @brief Enum for the OpenMP thread affinity policies.
+ */
+enum class ProcBind {
+    Default,  ///< No proc_bind clause.
+    Primary,  ///< proc_bind(primary), requires OpenMP 5.1, older ones name it `master`.
+    Close,    ///< proc_bind(close).
+    Spread,   ///< proc_bind(spread).
+};
+
+/**
+ * @brief Represents the OpenMP scheduling policy of a top-level @outer loop.
+ */
+struct ScheduleInfo {
+    ScheduleKind kind = ScheduleKind::Default;  ///< The schedule kind.
+    int chunk = -1;                             ///< The chunk size. -1 if not specified.
+    ProcBind procBind = ProcBind::Default;      ///< The thread affinity policy.
+    int numThreads = -1;  ///< The number of threads. -1 if not specified.
+
+    /**
+     * @brief Checks if none of the policy fields is specified.
+     *
+     * @return bool True if the default OpenMP policy is used.
+     */
+    [[nodiscard]] bool empty() const {
+        return kind == ScheduleKind::Default && chunk < 0 && procBind == ProcBind::Default &&
+               numThreads < 0;
+    }
+};
+
+/**
+ * @brief Converts a ScheduleKind to a string.
+ *
+ * @param kind The ScheduleKind to convert.
+ * @return std::string The string representation of the ScheduleKind.
+ */
+inline std::string toString(ScheduleKind kind) {
+    switch (kind) {
+        case ScheduleKind::Default:
+            return "default";
+        case ScheduleKind::Static:
+            return "static";
+        case ScheduleKind::Dynamic:
+            return "dynamic";
+        case ScheduleKind::Guided:
+            return "guided";
+        case ScheduleKind::Auto:
+            return "auto";
+        case ScheduleKind::Runtime:
+            return "runtime";
+    }
+    return "<uknown>";
+}
+
+/**
+ * @brief Converts a ProcBind to a string.
+ *
+ * @param bind The ProcBind to convert.
+ * @return std::string The string representation of the ProcBind.
+ */
+inline std::string toString(ProcBind bind) {
+    switch (bind) {
+        case ProcBind::Default:
+            return "default";
+        case ProcBind::Primary:
+            return "primary";
+        case ProcBind::Close:
+            return "close";
+        case ProcBind::Spread:
+            return "spread";
+    }
+    return "<uknown>";
+}
+
+/**
+ * @brief Converts a string to a ScheduleKind.
+ *
+ * @param str The string to convert.
+ * @return std::optional<ScheduleKind> The ScheduleKind or std::nullopt for unknown kind.
+ */
+std::optional<ScheduleKind> scheduleKindFromString(const std::string& str);
+
+/**
+ * @brief Converts a string to a ProcBind.
+ *
+ * @param str The string to convert.
+ * @return std::optional<ProcBind> The ProcBind or std::nullopt for unknown policy.
+ */
+std::optional<ProcBind> procBindFromString(const std::string& str);
+
+/**
+ * @brief Represents the resources of a device kernel that define its occupancy.
+ */
+struct OccupancyInfo {
+    int threadsPerBlock = -1;   ///< Threads per block. -1 if not known at transpile time.
+    int minBlocks = -1;         ///< Minimum blocks per multiprocessor. -1 if not specified.
+    size_t sharedBytes = 0;     ///< Static @shared memory per block in bytes.
+    size_t exclusiveBytes = 0;  ///< @exclusive memory per thread in bytes.
+    int wavefrontSize = -1;     ///< Threads per warp/wavefront the kernel is generated for.
+};
+
+/**
+ * @brief Represents global memory accesses of @inner loops, classified by addresses of
+ * consecutive threads along x axis.
+ */
+struct CoalescingInfo {
+    size_t coalesced = 0;  ///< Consecutive or the same elements.
+    size_t strided = 0;    ///< Elements of constant or runtime stride apart.
+    size_t scattered = 0;  ///< Data dependent or non-affine addresses.
+    NLOHMANN_DEFINE_TYPE_INTRUSIVE(CoalescingInfo, coalesced, strided, scattered);
+};
+
+/**
+ * @brief Represents the size of dynamic shared memory of a kernel in bytes, that is at least
+ * `constant + sum(scale * argument)` over integer kernel arguments.
+ */
+struct DynamicSharedBytes {
+    /**
+     * @brief Represents bytes per unit of an integer kernel argument.
+     */
+    struct Term {
+        std::string arg;    ///< The name of the argument.
+        size_t index = 0;   ///< The index of the argument in `KernelInfo::args`.
+        int64_t scale = 0;  ///< Bytes per unit of the argument.
+        NLOHMANN_DEFINE_TYPE_INTRUSIVE(Term, arg, index, scale);
+    };
+    int64_t constant = 0;     ///< Bytes that don't depend on arguments.
+    std::vector<Term> terms;  ///< Bytes that depend on arguments.
+    NLOHMANN_DEFINE_TYPE_INTRUSIVE(DynamicSharedBytes, constant, terms);
+};
+
 /**
  * @brief Represents a kernel function.
  */
 struct KernelInfo {
     std::string name;                ///< The name of the kernel function.
     std::vector<ArgumentInfo> args;  ///< The arguments of the kernel function.
+    std::vector<ScheduleInfo>
+        schedules;  ///< OpenMP policy of each top-level @outer loop. Empty for default policy.
+    std::string firstTouch;  ///< Companion kernel that first-touches buffers. Empty if absent.
+    std::optional<DynamicSharedBytes> sharedBytes;  ///< Dynamic shared memory size.
+    std::map<std::string, size_t>
+        sharedPadding;  ///< Elements appended to the innermost extent of @shared arrays.
+    std::optional<OccupancyInfo> occupancy;  ///< Resources of CUDA/HIP kernels.
+    std::optional<CoalescingInfo> coalescing;  ///< Global memory access patterns of GPU kernels.
+    size_t fusedOuterLoops = 0;  ///< Top-level @outer loops fused into the kernel, 0 if not fused.
+    std::map<std::string, int64_t> tuningValues;  ///< Constant arguments of a tuning variant.
 };
 
 /**
@@ -184,6 +339,40 @@ void to_json(nlohmann::json& json, const ArgumentInfo& argInfo);
  */
 void from_json(const nlohmann::json& json, ArgumentInfo& argInfo);
 
+// INFO: unspecified fields are skipped
+/**
+ * @brief Converts a ScheduleInfo to a JSON object.
+ *
+ * @param json The JSON object to convert to.
+ * @param schedule The ScheduleInfo to convert.
+ */
+void to_json(nlohmann::json& json, const ScheduleInfo& schedule);
+
+/**
+ * @brief Converts a JSON object to a ScheduleInfo.
+ *
+ * @param json The JSON object to convert from.
+ * @param schedule The ScheduleInfo to convert to.
+ */
+void from_json(const nlohmann::json& json, ScheduleInfo& schedule);
+
+// INFO: unspecified fields are skipped
+/**
+ * @brief Converts an OccupancyInfo to a JSON object.
+ *
+ * @param json The JSON object to convert to.
+ * @param occupancy The OccupancyInfo to convert.
+ */
+void to_json(nlohmann::json& json, const OccupancyInfo& occupancy);
+
+/**
+ * @brief Converts a JSON object to an OccupancyInfo.
+ *
+ * @param json The JSON object to convert from.
+ * @param occupancy The OccupancyInfo to convert to.
+ */
+void from_json(const nlohmann::json& json, OccupancyInfo& occupancy);
+
 // INFO: skip some fields in serialization/deserialization process
 /**
  * @brief Converts a KernelInfo to a JSON object.
@@ -16,6 +16,8 @@ enum struct TargetBackend : unsigned char {
     DPCPP,   ///< DPCPP backend.
 
     _LAUNCHER,  ///< Launcher backend.
+
+    THREADS,  ///< std::thread pool backend. Appended to keep values of the others.
 };
 
 /**
@@ -51,4 +53,12 @@ bool isHostCategory(TargetBackend backend);
  */
 bool isDeviceCategory(TargetBackend backend);
 
+/**
+ * @brief Gets the number of threads in warp/wavefront of the usual targets of the backend.
+ *
+ * @param backend The TargetBackend.
+ * @return size_t 32 for CUDA, 64 for HIP, 0 if there is no fixed size.
+ */
+size_t getDefaultWavefrontSize(TargetBackend backend);
+
 }  // namespace oklt
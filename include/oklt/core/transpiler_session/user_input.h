@@ -1,7 +1,9 @@
 #pragma once
 
+#include <oklt/core/kernel_metadata.h>
 #include <oklt/core/target_backends.h>
 
+#include <cstdint>
 #include <filesystem>
 #include <map>
 #include <vector>
@@ -19,6 +21,23 @@ struct UserInput {
     std::vector<std::filesystem::path> includeDirectories;  ///< The include directories.
     std::vector<std::string> defines;                       ///< The defined macroses.
     std::string hash;                                       ///< OKL hash
+    ScheduleInfo ompSchedule;  ///< Default OpenMP policy of loops without @schedule. proc_bind
+                               ///< primary requires OpenMP 5.1.
+    bool peelTileRemainder = false;  ///< Peel checked @tile remainder on host backends by default.
+    bool numaPartition = false;  ///< Static NUMA-aware partition and first-touch kernels (OpenMP).
+    bool dynamicShared = false;  ///< Pack @shared variables into dynamic shared memory (CUDA/HIP).
+    bool inferReadOnlyArgs = false;  ///< Make pointer args that are never written const restrict.
+    bool reduceUniformAtomics = false;  ///< Reduce uniform @atomic updates over warp/work-group.
+    bool localAccessorShared = false;  ///< Declare @shared as sycl::local_accessor (DPC++).
+    bool padSharedBanks = false;  ///< Pad @shared arrays accessed column-wise (CUDA/HIP/DPC++).
+    bool analyzeCoalescing = false;  ///< Report uncoalesced global memory accesses of @inner.
+    bool fuseOuterLoops = false;  ///< Fuse consecutive independent @outer loops (CUDA/HIP/DPC++).
+    std::map<std::string, int64_t> constantArgs;  ///< Values of const integer @kernel arguments.
+    bool dropConstantArgs = false;  ///< Remove arguments bound by constantArgs from device kernels.
+    /// Values of constant arguments of each extra kernel variant (CUDA/HIP/DPC++).
+    std::vector<std::map<std::string, int64_t>> tuningGrid;
+    size_t wavefrontSize = 0;  ///< Threads per warp/wavefront (CUDA/HIP), 0 for backend default.
+    bool eliminateDeadDecls = false;  ///< Emit only declarations reachable from @kernel functions.
 };
 
 }  // namespace oklt
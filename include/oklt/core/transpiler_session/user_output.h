@@ -1,7 +1,10 @@
 #pragma once
 
+#include <oklt/core/error.h>
+
 #include <map>
 #include <string>
+#include <vector>
 
 #include <tl/expected.hpp>
 
@@ -25,6 +28,8 @@ struct UserOutput {
         std::string source;    ///< The launcher source code.
         std::string metadata;  ///< The launcher metadata (dumped as JSON)
     } launcher;
+
+    std::vector<Warning> warnings;  ///< Warnings of all stages, formatted as clang diagnostics
 };
 
 struct Error;
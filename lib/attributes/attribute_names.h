@@ -10,12 +10,17 @@ constexpr const char SHARED_ATTR_NAME[] = "okl_shared";
 constexpr const char DIM_ATTR_NAME[] = "okl_dim";
 constexpr const char DIM_ORDER_ATTR_NAME[] = "okl_dimOrder";
 constexpr const char RESTRICT_ATTR_NAME[] = "okl_restrict";
+constexpr const char NO_RESTRICT_ATTR_NAME[] = "okl_norestrict";
 constexpr const char BARRIER_ATTR_NAME[] = "okl_barrier";
 constexpr const char NO_BARRIER_ATTR_NAME[] = "okl_nobarrier";
 constexpr const char EXCLUSIVE_ATTR_NAME[] = "okl_exclusive";
 constexpr const char ATOMIC_ATTR_NAME[] = "okl_atomic";
 constexpr const char MAX_INNER_DIMS_NAME[] = "okl_max_inner_dims";
 constexpr const char SIMD_LENGTH_NAME[] = "okl_simd_length";
+constexpr const char SCHEDULE_ATTR_NAME[] = "okl_schedule";
+constexpr const char MIN_BLOCKS_ATTR_NAME[] = "okl_min_blocks";
+constexpr const char PIPELINE_ATTR_NAME[] = "okl_pipeline";
+constexpr const char UNROLL_ATTR_NAME[] = "okl_unroll";
 
 const int CXX_ATTRIBUTE_BEGIN_TO_NAME_OFFSET = 2;
 const int GNU_ATTRIBUTE_BEGIN_TO_NAME_OFFSET = 15;
@@ -2,12 +2,14 @@
 #include "attributes/attribute_names.h"
 #include "attributes/utils/parser.h"
 #include "core/handler_manager/attr_handler.h"
+#include "core/sema/okl_sema_ctx.h"
 #include "core/transpiler_session/attributed_type_map.h"
 #include "core/utils/attributes.h"
 #include "core/utils/range_to_string.h"
 
 #include <spdlog/spdlog.h>
 #include <algorithm>
+#include <cctype>
 #include <numeric>
 
 namespace {
@@ -16,6 +18,14 @@ using namespace clang;
 using ExprVec = std::vector<const Expr*>;
 using DimOrder = std::vector<size_t>;
 
+const std::string DIM_INDEX_BASE_PREFIX = "_occa_dim_";
+
+// Argument of @dim access, split into a variable, that is invariant in the loop, and an offset
+struct DimIndexArg {
+    const ValueDecl* var = nullptr;
+    int64_t offset = 0;
+};
+
 HandleResult handleDimDeclAttribute(SessionStage& s,
                                     const clang::Decl& decl,
                                     const clang::Attr& a,
@@ -159,6 +169,170 @@ std::string buildIndexCalculation(SessionStage& stage,
     return indexCalculation;
 }
 
+// Iteration variables of the loop and its attributed parents, and `const` parameters, are not
+// modified in the loop body
+bool isInvariant(const ValueDecl& decl, OklLoopInfo& loop) {
+    if (isa<ParmVarDecl>(decl)) {
+        return decl.getType().isConstQualified();
+    }
+    for (auto* it = &loop; it; it = it->getAttributedParent()) {
+        if (it->var.varDecl == &decl) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Dimension size must be visible at the beginning of the loop body
+bool isInvariant(const std::string& dim, OklLoopInfo& loop, const FunctionDecl& kernel) {
+    if (!dim.empty() && std::all_of(dim.begin(), dim.end(), ::isdigit)) {
+        return true;
+    }
+    for (const auto* param : kernel.parameters()) {
+        if (param && param->getName() == dim) {
+            return isInvariant(*param, loop);
+        }
+    }
+    for (auto* it = &loop; it; it = it->getAttributedParent()) {
+        if (it->var.name == dim) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Accepts `c`, `v`, `v + c`, `c + v` and `v - c`
+std::optional<DimIndexArg> splitDimIndexArg(const Expr& arg, ASTContext& ctx, OklLoopInfo& loop) {
+    auto evaluate = [&ctx](const Expr& e) -> std::optional<int64_t> {
+        Expr::EvalResult result;
+        if (e.isValueDependent() || !e.EvaluateAsInt(result, ctx)) {
+            return std::nullopt;
+        }
+        return result.Val.getInt().getExtValue();
+    };
+    auto getVar = [&loop](const Expr& e) -> const ValueDecl* {
+        const auto* ref = dyn_cast<DeclRefExpr>(e.IgnoreParenImpCasts());
+        return ref && isInvariant(*ref->getDecl(), loop) ? ref->getDecl() : nullptr;
+    };
+
+    if (auto value = evaluate(arg)) {
+        return DimIndexArg{nullptr, *value};
+    }
+    if (const auto* var = getVar(arg)) {
+        return DimIndexArg{var, 0};
+    }
+
+    const auto* binOp = dyn_cast<BinaryOperator>(arg.IgnoreParenImpCasts());
+    if (!binOp || !binOp->isAdditiveOp()) {
+        return std::nullopt;
+    }
+    const auto* var = getVar(*binOp->getLHS());
+    auto value = evaluate(*binOp->getRHS());
+    if (binOp->getOpcode() == BO_Add && (!var || !value)) {
+        var = getVar(*binOp->getRHS());
+        value = evaluate(*binOp->getLHS());
+    }
+    if (!var || !value) {
+        return std::nullopt;
+    }
+    return DimIndexArg{var, binOp->getOpcode() == BO_Add ? *value : -*value};
+}
+
+// Multi-dimensional accesses of a stencil share the loop invariant index math:
+// `A(i + 1, j)` is replaced with `A[base + 1]`, where `const auto base = i + X * j;` is declared
+// at the beginning of the nearest @outer or @inner loop.
+std::optional<std::string> buildHoistedIndexCalculation(SessionStage& stage,
+                                                        const Stmt& stmt,
+                                                        const ExprVec& dimVarArgs,
+                                                        const AttributedDim* params,
+                                                        const DimOrder& dimOrder) {
+    if (stage.getBackend() == TargetBackend::_LAUNCHER) {
+        return std::nullopt;
+    }
+
+    auto& sema = stage.tryEmplaceUserCtx<OklSemaCtx>();
+    auto* kernelInfo = sema.getParsingKernelInfo();
+    auto* loop = sema.getLoopInfo();
+    if (loop && loop->isRegular()) {
+        loop = loop->getAttributedParent();
+    }
+    if (!kernelInfo || !loop) {
+        return std::nullopt;
+    }
+
+    auto& ctx = stage.getCompiler().getASTContext();
+    auto& sm = ctx.getSourceManager();
+    const auto* body = dyn_cast_or_null<CompoundStmt>(loop->stmt.getBody());
+    if (!body || !sm.isBeforeInTranslationUnit(body->getLBracLoc(), stmt.getBeginLoc()) ||
+        !sm.isBeforeInTranslationUnit(stmt.getEndLoc(), body->getRBracLoc())) {
+        return std::nullopt;
+    }
+
+    std::string base;
+    std::string offsetStr;
+    int64_t offset = 0;
+    std::string stride;
+    bool isConstStride = true;
+    int64_t constStride = 1;
+    bool hasProduct = false;
+    for (size_t i = 0; i < dimOrder.size(); ++i) {
+        auto arg = splitDimIndexArg(*dimVarArgs[dimOrder[i]], ctx, *loop);
+        if (!arg) {
+            return std::nullopt;
+        }
+        auto strideStr = isConstStride ? std::to_string(constStride) : stride;
+
+        if (arg->var) {
+            auto term = arg->var->getNameAsString();
+            if (i > 0) {
+                term = strideStr + " * " + term;
+                hasProduct = true;
+            }
+            base += (base.empty() ? "" : " + ") + term;
+        }
+
+        if (isConstStride) {
+            offset += arg->offset * constStride;
+        } else if (arg->offset) {
+            auto factor = arg->offset > 0 ? arg->offset : -arg->offset;
+            offsetStr += (arg->offset > 0 ? " + " : " - ") +
+                         (factor == 1 ? "" : std::to_string(factor) + " * ") + strideStr;
+        }
+
+        if (i + 1 == dimOrder.size()) {
+            break;
+        }
+        // Stride of the next dimension
+        const auto& dim = params->dim[dimOrder[i]];
+        if (!isInvariant(dim, *loop, kernelInfo->decl.get())) {
+            return std::nullopt;
+        }
+        stride = strideStr == "1" ? dim : strideStr + " * " + dim;
+        if (isConstStride && std::all_of(dim.begin(), dim.end(), ::isdigit)) {
+            constStride *= util::parseStrTo<int64_t>(dim).value_or(0);
+        } else {
+            isConstStride = false;
+        }
+    }
+    if (!hasProduct) {
+        return std::nullopt;
+    }
+
+    auto& baseName = loop->dimIndexBases[base];
+    if (baseName.empty()) {
+        baseName = DIM_INDEX_BASE_PREFIX + loop->var.name + "_" +
+                   std::to_string(loop->dimIndexBases.size() - 1);
+        stage.getRewriter().InsertTextAfterToken(body->getLBracLoc(),
+                                                 "\nconst auto " + baseName + " = " + base + ";\n");
+    }
+
+    auto index = baseName;
+    if (offset) {
+        index += (offset > 0 ? " + " : " - ") + std::to_string(offset > 0 ? offset : -offset);
+    }
+    return index + offsetStr;
+}
+
 HandleResult handleDimStmtAttribute(SessionStage& stage,
                                     const clang::Stmt& stmt,
                                     const clang::Attr& a,
@@ -200,10 +374,14 @@ HandleResult handleDimStmtAttribute(SessionStage& stage,
 
     auto dimVarNameStr = getSourceText(*dimVarExpr, ctx);
     ExprVec dimVarArgs(expressions.value().begin() + 1, expressions.value().end());
-    auto indexCalculation = buildIndexCalculation(stage, dimVarArgs, params, dimOrder.value());
+    auto indexCalculation =
+        buildHoistedIndexCalculation(stage, stmt, dimVarArgs, params, dimOrder.value());
+    if (!indexCalculation) {
+        indexCalculation = buildIndexCalculation(stage, dimVarArgs, params, dimOrder.value());
+    }
 
     stage.getRewriter().ReplaceText(stmt.getSourceRange(),
-                                    util::fmt("{}[{}]", dimVarNameStr, indexCalculation).value());
+                                    util::fmt("{}[{}]", dimVarNameStr, *indexCalculation).value());
     return {};
 }
 
@@ -0,0 +1,52 @@
+#include "attributes/attribute_names.h"
+#include "attributes/frontend/params/loop.h"
+#include "core/handler_manager/attr_handler.h"
+#include "core/sema/okl_sema_ctx.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/attributes.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+HandleResult handleMinBlocksStmtAttribute(SessionStage& s,
+                                          const clang::ForStmt& forStmt,
+                                          const clang::Attr& a,
+                                          const AttributedLoopMinBlocks* params) {
+    SPDLOG_DEBUG("Handle [@min_blocks] attribute");
+    if (!params) {
+        return tl::make_unexpected(Error{std::error_code(), "@min_blocks params nullptr"});
+    }
+
+    auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
+    auto loopInfo = sema.getLoopInfo(forStmt);
+    if (!loopInfo) {
+        return tl::make_unexpected(
+            Error{{}, "@min_blocks: failed to fetch loop meta data from sema"});
+    }
+
+    if (loopInfo->getAttributedParent() || !loopInfo->has(LoopType::Outer)) {
+        return tl::make_unexpected(
+            Error{{}, "[@min_blocks] must be applied to a top-level [@outer] loop"});
+    }
+
+    if (params->size <= 0) {
+        return tl::make_unexpected(Error{{}, "[@min_blocks] argument must be positive"});
+    }
+
+    loopInfo->minBlocks = params->size;
+
+    removeAttribute(s, a);
+    return {};
+}
+
+__attribute__((constructor)) void registerAttrBackend() {
+    auto ok = registerCommonHandler(MIN_BLOCKS_ATTR_NAME, handleMinBlocksStmtAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("Failed to register {} attribute handler", MIN_BLOCKS_ATTR_NAME);
+    }
+}
+}  // namespace
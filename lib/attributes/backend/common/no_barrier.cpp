@@ -21,7 +21,7 @@ HandleResult handleNoBarrierStmtAttribute(SessionStage& s,
             Error{{}, "@nobarrier: failed to fetch loop meta data from sema"});
     }
 
-    loopInfo->sharedInfo.used = false;
+    loopInfo->sharedInfo.nobarrierApplied = true;
 
     removeAttribute(s, a);
     return {};
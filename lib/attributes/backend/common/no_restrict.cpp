@@ -0,0 +1,29 @@
+#include "attributes/attribute_names.h"
+#include "core/handler_manager/attr_handler.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/attributes.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+// Read-only inference already skipped the parameter, so the attribute is just dropped
+HandleResult handleNoRestrictDeclAttribute(SessionStage& s,
+                                           const clang::Decl& decl,
+                                           const clang::Attr& a) {
+    SPDLOG_DEBUG("Handle [@norestrict] attribute");
+
+    removeAttribute(s, a);
+    return {};
+}
+
+__attribute__((constructor)) void registerAttrBackend() {
+    auto ok = registerCommonHandler(NO_RESTRICT_ATTR_NAME, handleNoRestrictDeclAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("Failed to register {} attribute handler", NO_RESTRICT_ATTR_NAME);
+    }
+}
+}  // namespace
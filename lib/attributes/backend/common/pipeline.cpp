@@ -0,0 +1,48 @@
+#include "attributes/attribute_names.h"
+#include "attributes/frontend/params/loop.h"
+#include "core/handler_manager/attr_handler.h"
+#include "core/sema/okl_sema_ctx.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/attributes.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+// Backends without asynchronous copies keep the loop as is, i.e. copies stay synchronous
+HandleResult handlePipelineStmtAttribute(SessionStage& s,
+                                         const clang::ForStmt& forStmt,
+                                         const clang::Attr& a,
+                                         const AttributedLoopPipeline* params) {
+    SPDLOG_DEBUG("Handle [@pipeline] attribute");
+    if (!params) {
+        return tl::make_unexpected(Error{std::error_code(), "@pipeline params nullptr"});
+    }
+
+    auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
+    auto loopInfo = sema.getLoopInfo(forStmt);
+    if (!loopInfo) {
+        return tl::make_unexpected(
+            Error{{}, "@pipeline: failed to fetch loop meta data from sema"});
+    }
+
+    if (!loopInfo->is(LoopType::Inner)) {
+        s.pushWarning("[@pipeline] is applied to [@inner] loops only, ignored");
+    } else if (params->stages > 1) {
+        loopInfo->pipelineStages = params->stages;
+    }
+
+    removeAttribute(s, a);
+    return {};
+}
+
+__attribute__((constructor)) void registerAttrBackend() {
+    auto ok = registerCommonHandler(PIPELINE_ATTR_NAME, handlePipelineStmtAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("Failed to register {} attribute handler", PIPELINE_ATTR_NAME);
+    }
+}
+}  // namespace
@@ -0,0 +1,50 @@
+#include "attributes/attribute_names.h"
+#include "attributes/frontend/params/loop.h"
+#include "core/handler_manager/attr_handler.h"
+#include "core/sema/okl_sema_ctx.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/attributes.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+// INFO: the policy is only stored in sema, host backends decide how to lower it, device backends
+// ignore it
+HandleResult handleScheduleStmtAttribute(SessionStage& s,
+                                         const clang::ForStmt& forStmt,
+                                         const clang::Attr& a,
+                                         const AttributedLoopSchedule* params) {
+    SPDLOG_DEBUG("Handle [@schedule] attribute");
+    if (!params) {
+        return tl::make_unexpected(Error{std::error_code(), "@schedule params nullptr"});
+    }
+
+    auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
+    auto loopInfo = sema.getLoopInfo(forStmt);
+    if (!loopInfo) {
+        return tl::make_unexpected(
+            Error{{}, "@schedule: failed to fetch loop meta data from sema"});
+    }
+
+    if (loopInfo->getAttributedParent() || !loopInfo->has(LoopType::Outer)) {
+        return tl::make_unexpected(
+            Error{{}, "[@schedule] must be applied to a top-level [@outer] loop"});
+    }
+
+    loopInfo->schedule = params->policy;
+
+    removeAttribute(s, a);
+    return {};
+}
+
+__attribute__((constructor)) void registerAttrBackend() {
+    auto ok = registerCommonHandler(SCHEDULE_ATTR_NAME, handleScheduleStmtAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("Failed to register {} attribute handler", SCHEDULE_ATTR_NAME);
+    }
+}
+}  // namespace
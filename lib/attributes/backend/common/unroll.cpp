@@ -0,0 +1,162 @@
+#include "attributes/attribute_names.h"
+#include "attributes/frontend/params/loop.h"
+#include "core/handler_manager/attr_handler.h"
+#include "core/sema/okl_sema_ctx.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/attributes.h"
+#include "core/utils/range_to_string.h"
+
+#include <clang/AST/AST.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+const size_t MAX_EXPANDED_ITERATIONS = 64;
+// Largest factor accepted by `#pragma GCC unroll`
+const size_t MAX_GCC_UNROLL_FACTOR = 65534;
+
+// Loop hint of the backend compiler, empty if the backend has none
+std::string getUnrollPragma(TargetBackend backend, int factor, size_t rangeSize) {
+    switch (backend) {
+        case TargetBackend::CUDA:
+        case TargetBackend::HIP:
+        case TargetBackend::DPCPP:
+            return factor > 0 ? "#pragma unroll " + std::to_string(factor) : "#pragma unroll";
+        case TargetBackend::SERIAL:
+        case TargetBackend::OPENMP:
+        case TargetBackend::THREADS: {
+            // GCC requires the factor, so full unrolling is requested by the range size
+            auto count = factor > 0 ? static_cast<size_t>(factor) : rangeSize;
+            if (!count) {
+                return "";
+            }
+            return "#pragma GCC unroll " + std::to_string(std::min(count, MAX_GCC_UNROLL_FACTOR));
+        }
+        default:
+            return "";
+    }
+}
+
+// Statements, that can't be replicated per iteration
+class ExpansionBlocker : public RecursiveASTVisitor<ExpansionBlocker> {
+   public:
+    explicit ExpansionBlocker(const VarDecl* var)
+        : _var(var) {}
+
+    bool VisitBreakStmt(BreakStmt*) { return block(); }
+    bool VisitContinueStmt(ContinueStmt*) { return block(); }
+    bool VisitLabelStmt(LabelStmt*) { return block(); }
+
+    // Iteration variable is replaced by a constant
+    bool VisitUnaryOperator(UnaryOperator* op) {
+        return op->isIncrementDecrementOp() && isIterVar(*op->getSubExpr()) ? block() : true;
+    }
+    bool VisitBinaryOperator(BinaryOperator* op) {
+        return op->isAssignmentOp() && isIterVar(*op->getLHS()) ? block() : true;
+    }
+
+    bool isBlocked(const Stmt& body) {
+        TraverseStmt(const_cast<Stmt*>(&body));
+        return _blocked;
+    }
+
+   private:
+    bool isIterVar(const Expr& expr) {
+        const auto* ref = dyn_cast<DeclRefExpr>(expr.IgnoreParenImpCasts());
+        return ref && ref->getDecl() == _var;
+    }
+
+    bool block() {
+        _blocked = true;
+        return false;
+    }
+
+    const VarDecl* _var;
+    bool _blocked = false;
+};
+
+// Replaces the loop with a copy of its body per iteration:
+// `{ { T i = start; body } { T i = start + 1; body } ... }`
+bool expandLoop(SessionStage& s, const ForStmt& forStmt, const Attr& a, const OklLoopInfo* loop) {
+    if (!loop || !loop->var.varDecl || !loop->range.start || !loop->range.size ||
+        loop->range.size > MAX_EXPANDED_ITERATIONS || !loop->isUnary()) {
+        return false;
+    }
+
+    bool isInc = loop->inc.op.uo == UnOp::PreInc || loop->inc.op.uo == UnOp::PostInc;
+    if (loop->condition.op != (isInc ? BinOp::Lt : BinOp::Gt)) {
+        return false;
+    }
+
+    auto& ctx = s.getCompiler().getASTContext();
+    Expr::EvalResult start;
+    const auto* body = dyn_cast_or_null<CompoundStmt>(forStmt.getBody());
+    if (!body || !loop->range.start->EvaluateAsInt(start, ctx) ||
+        ExpansionBlocker(loop->var.varDecl).isBlocked(*body)) {
+        return false;
+    }
+
+    auto& rewriter = s.getRewriter();
+    auto bodyStr = getLatestSourceText(*body, rewriter);
+    auto first = start.Val.getInt().getExtValue();
+    std::string expanded = "{\n";
+    for (size_t i = 0; i < loop->range.size; ++i) {
+        auto value = isInc ? first + static_cast<int64_t>(i) : first - static_cast<int64_t>(i);
+        expanded += "{\n" + loop->var.typeName + " " + loop->var.name + " = " +
+                    std::to_string(value) + ";\n" + bodyStr + "\n}\n";
+    }
+    expanded += "}";
+
+    rewriter.ReplaceText(SourceRange{getAttrFullSourceRange(a).getBegin(), forStmt.getEndLoc()},
+                         expanded);
+    return true;
+}
+
+HandleResult handleUnrollStmtAttribute(SessionStage& s,
+                                       const clang::ForStmt& forStmt,
+                                       const clang::Attr& a,
+                                       const AttributedLoopUnroll* params) {
+    SPDLOG_DEBUG("Handle [@unroll] attribute");
+    if (!params) {
+        return tl::make_unexpected(Error{std::error_code(), "@unroll params nullptr"});
+    }
+
+    auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
+    auto loopInfo = sema.getLoopInfo(forStmt);
+    if (params->expand) {
+        if (expandLoop(s, forStmt, a, loopInfo)) {
+            return {};
+        }
+        s.pushWarning(
+            "[@unroll] loop is not expanded: trip count of unit step loop must be known at compile "
+            "time and not exceed " +
+            std::to_string(MAX_EXPANDED_ITERATIONS) +
+            ", body must not contain break, continue, labels or modify loop variable");
+    }
+
+    auto rangeSize = loopInfo ? loopInfo->range.size : 0;
+    auto pragma = getUnrollPragma(s.getBackend(), params->factor, rangeSize);
+    if (pragma.empty()) {
+        removeAttribute(s, a);
+        return {};
+    }
+
+    // Pragma must be placed on its own line
+    s.getRewriter().ReplaceText(getAttrFullSourceRange(a), "\n" + pragma + "\n");
+    return {};
+}
+
+__attribute__((constructor)) void registerAttrBackend() {
+    auto ok = registerCommonHandler(UNROLL_ATTR_NAME, handleUnrollStmtAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("Failed to register {} attribute handler", UNROLL_ATTR_NAME);
+    }
+}
+}  // namespace
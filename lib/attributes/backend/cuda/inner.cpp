@@ -1,6 +1,15 @@
 #include "attributes/attribute_names.h"
+#include "attributes/utils/async_copy_pipeline.h"
+#include "attributes/utils/cuda_subset/common.h"
 #include "attributes/utils/cuda_subset/handle.h"
+#include "attributes/utils/kernel_utils.h"
 #include "core/handler_manager/backend_handler.h"
+#include "core/sema/okl_sema_ctx.h"
+#include "core/transpiler_session/header_info.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/range_to_string.h"
+
+#include <clang/AST/AST.h>
 
 #include <spdlog/spdlog.h>
 
@@ -8,9 +17,103 @@ namespace {
 using namespace oklt;
 using namespace clang;
 
+const std::string PIPELINE_ITER = "_occa_pipeline_iter";
+const std::string PIPELINE_STAGE = "_occa_pipeline_stage";
+
+// Copies of the iteration `t` are issued `stages - 1` iterations ahead of its compute:
+//   for (iter = start; iter < end + stages - 1; ++iter) {
+//     { t = iter; if (t < end) { copy to buffer (t - start) % stages } commit; }
+//     wait for copies of iteration iter - (stages - 1); barrier;
+//     { t = iter - (stages - 1); if (t >= start) { compute on buffer (t - start) % stages } }
+//   }
+HandleResult applyAsyncCopyPipeline(SessionStage& s, const AsyncCopyPipeline& pipeline) {
+    auto& ctx = s.getCompiler().getASTContext();
+    auto& rewriter = s.getRewriter();
+    auto& loop = *pipeline.loop;
+    const auto& var = loop.var;
+    const auto* body = cast<CompoundStmt>(loop.stmt.getBody());
+
+    auto start = "(" + getLatestSourceText(*loop.range.start, rewriter) + ")";
+    auto end = "(" + getLatestSourceText(*loop.range.end, rewriter) + ")";
+    auto ahead = std::to_string(pipeline.stages - 1);
+    auto stageLine = "const int " + PIPELINE_STAGE + " = (" + var.name + " - " + start + ") % " +
+                     std::to_string(pipeline.stages) + ";\n";
+
+    rewriter.ReplaceText(SourceRange{loop.stmt.getForLoc(), loop.stmt.getRParenLoc()},
+                         "for (" + var.typeName + " " + PIPELINE_ITER + " = " + start + "; " +
+                             PIPELINE_ITER + " < " + end + " + " + ahead + "; ++" +
+                             PIPELINE_ITER + ")");
+    rewriter.InsertTextAfterToken(body->getLBracLoc(),
+                                  "\n{\n" + var.typeName + " " + var.name + " = " +
+                                      PIPELINE_ITER + ";\nif (" + var.name + " < " + end +
+                                      ") {\n" + stageLine);
+    // Inserted after the code of @inner loop handler
+    rewriter.InsertText(pipeline.copy->stmt.getEndLoc().getLocWithOffset(1),
+                        "\n}\nokl_pipeline_commit();\n}\nokl_pipeline_wait_prior(" + ahead +
+                            ");\n" + cuda_subset::SYNC_THREADS_BARRIER + ";\n{\n" +
+                            var.typeName + " " + var.name + " = " + PIPELINE_ITER + " - " +
+                            ahead + ";\nif (" + var.name + " >= " + start + ") {\n" + stageLine);
+
+    // Buffer read by this iteration is overwritten by copies of the next one
+    auto& last = loop.children.back();
+    std::string closeCode = "}\n}\n";
+    if (&last == pipeline.copy || !last.shouldSync()) {
+        closeCode += cuda_subset::SYNC_THREADS_BARRIER + ";\n";
+    }
+    rewriter.InsertTextBefore(body->getRBracLoc(), closeCode);
+
+    for (const auto* copy : pipeline.copies) {
+        auto type = copy->getLHS()->getType().getUnqualifiedType();
+        rewriter.InsertTextBefore(copy->getBeginLoc(), "okl_memcpy_async(&");
+        rewriter.ReplaceText(copy->getOperatorLoc(), 1, ", &(");
+        rewriter.InsertTextAfterToken(
+            copy->getEndLoc(), "), sizeof(" + type.getAsString(ctx.getPrintingPolicy()) + "))");
+    }
+
+    for (const auto* ref : pipeline.tileRefs) {
+        rewriter.InsertTextAfterToken(ref->getEndLoc(), "[" + PIPELINE_STAGE + "]");
+    }
+
+    auto& staticMemory = loop.getAttributedRoot()->staticMemory;
+    for (const auto* tile : pipeline.tiles) {
+        rewriter.InsertTextAfterToken(tile->getLocation(),
+                                      "[" + std::to_string(pipeline.stages) + "]");
+        staticMemory.sharedBytes +=
+            (pipeline.stages - 1) * ctx.getTypeSizeInChars(tile->getType()).getQuantity();
+    }
+
+    // Asynchronous copy primitives are taken from the intrinsic header
+    s.tryEmplaceUserCtx<HeaderDepsInfo>().useOklIntrinsic = true;
+    return {};
+}
+
+HandleResult handleCUDAInnerAttribute(SessionStage& s,
+                                      const clang::ForStmt& forStmt,
+                                      const clang::Attr& a,
+                                      const AttributedLoop* params) {
+    handleChildAttr(s, forStmt, PIPELINE_ATTR_NAME);
+
+    auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
+    auto loopInfo = sema.getLoopInfo(forStmt);
+    std::optional<AsyncCopyPipeline> pipeline;
+    if (loopInfo) {
+        pipeline = matchAsyncCopyPipeline(s, *loopInfo);
+    }
+    if (pipeline) {
+        // Copies are synchronized after they are completed
+        loopInfo->sharedInfo.nobarrierApplied = true;
+    }
+
+    auto result = cuda_subset::handleInnerAttribute(s, forStmt, a, params);
+    if (!result || !pipeline) {
+        return result;
+    }
+    return applyAsyncCopyPipeline(s, *pipeline);
+}
+
 __attribute__((constructor)) void registerBackendHandler() {
-    auto ok = registerBackendHandler(
-        TargetBackend::CUDA, INNER_ATTR_NAME, cuda_subset::handleInnerAttribute);
+    auto ok =
+        registerBackendHandler(TargetBackend::CUDA, INNER_ATTR_NAME, handleCUDAInnerAttribute);
 
     if (!ok) {
         SPDLOG_ERROR("[CUDA] Failed to register {} attribute handler", INNER_ATTR_NAME);
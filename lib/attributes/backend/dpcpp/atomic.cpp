@@ -1,16 +1,59 @@
 #include "attributes/attribute_names.h"
+#include "attributes/utils/atomic_reduction.h"
 #include "core/handler_manager/backend_handler.h"
+#include "core/transpiler_session/attributed_type_map.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
 #include "core/utils/attributes.h"
 #include "core/utils/range_to_string.h"
 #include "pipeline/core/error_codes.h"
 
 #include <spdlog/spdlog.h>
 
+#include <map>
+
 namespace {
 using namespace oklt;
 using namespace clang;
 
+const std::map<std::string, std::string> GROUP_REDUCE_OPS = {
+    {"+", "sycl::plus"},
+    {"&", "sycl::bit_and"},
+    {"|", "sycl::bit_or"},
+    {"^", "sycl::bit_xor"},
+};
+
+const std::string ATOMIC_REF_FMT =
+    "sycl::atomic_ref<{},sycl::memory_order::relaxed,sycl::memory_scope::{},sycl::access::"
+    "address_space::{}>";
+
+// Variable that is indexed or accessed by field, e.g. `x` in `x[i].y`
+const Expr* getTargetBase(const Expr& target) {
+    const auto* expr = target.IgnoreParenImpCasts();
+    for (;;) {
+        if (const auto* subscript = dyn_cast<ArraySubscriptExpr>(expr)) {
+            expr = subscript->getBase()->IgnoreParenImpCasts();
+            continue;
+        }
+        if (const auto* member = dyn_cast<MemberExpr>(expr); member && !member->isArrow()) {
+            expr = member->getBase()->IgnoreParenImpCasts();
+            continue;
+        }
+        return expr;
+    }
+}
+
+// @shared variables live in work-group local memory, so device scope isn't needed for them
+std::string getAtomicRefStr(SessionStage& stage, const Expr& target, const std::string& typeStr) {
+    auto& ctx = stage.getCompiler().getASTContext();
+    auto& attrTypeMap = stage.tryEmplaceUserCtx<AttributedTypeMap>();
+    const auto* base = dyn_cast<DeclRefExpr>(getTargetBase(target));
+    if (base && attrTypeMap.has(ctx, base->getType(), {SHARED_ATTR_NAME})) {
+        return util::fmt(ATOMIC_REF_FMT, typeStr, "work_group", "local_space").value();
+    }
+    return util::fmt(ATOMIC_REF_FMT, typeStr, "device", "global_space").value();
+}
+
 tl::expected<std::string, Error> buildBinOp(SessionStage& stage,
                                             const Attr& attr,
                                             const BinaryOperator& binOp) {
@@ -19,13 +62,7 @@ tl::expected<std::string, Error> buildBinOp(SessionStage& stage,
     auto right = getSourceText(*binOp.getRHS(), ctx);
     auto op = binOp.getOpcodeStr().str();
     auto typeStr = binOp.getType().getAsString();
-    return util::fmt(
-        "sycl::atomic_ref<{},sycl::memory_order::relaxed,sycl::memory_scope::device,sycl::"
-        "access::address_space::global_space>({}) {} {}",
-        typeStr,
-        left,
-        op,
-        right);
+    return getAtomicRefStr(stage, *binOp.getLHS(), typeStr) + "(" + left + ") " + op + " " + right;
 }
 
 tl::expected<std::string, Error> buildUnOp(SessionStage& stage,
@@ -35,12 +72,7 @@ tl::expected<std::string, Error> buildUnOp(SessionStage& stage,
     auto expr = getSourceText(*unOp.getSubExpr(), ctx);
     auto op = unOp.getOpcodeStr(unOp.getOpcode()).str();
     auto typeStr = unOp.getType().getAsString();
-    return util::fmt(
-        "sycl::atomic_ref<{},sycl::memory_order::relaxed,sycl::memory_scope::device,sycl::"
-        "access::address_space::global_space>({}){}",
-        typeStr,
-        expr,
-        op);
+    return getAtomicRefStr(stage, *unOp.getSubExpr(), typeStr) + "(" + expr + ")" + op;
 }
 
 tl::expected<std::string, Error> buildCXXCopyOp(SessionStage& stage,
@@ -66,12 +98,7 @@ tl::expected<std::string, Error> buildCXXCopyOp(SessionStage& stage,
             Error{make_error_code(OkltPipelineErrorCode::ATOMIC_NON_LVALUE_EXPR),
                   leftText + ": is not lvalue"});
     }
-    return util::fmt(
-        "sycl::atomic_ref<{},sycl::memory_order::relaxed,sycl::memory_scope::device,sycl::"
-        "access::address_space::global_space>({}) = {}",
-        typeStr,
-        leftStr,
-        rigthStr);
+    return getAtomicRefStr(stage, *left, typeStr) + "(" + leftStr + ") = " + rigthStr;
 }
 
 tl::expected<std::string, Error> buildNewExpression(SessionStage& stage,
@@ -117,9 +144,43 @@ tl::expected<std::string, Error> buildNewExpression(SessionStage& stage,
     return tl::make_unexpected(Error{{}, "Error: Unable to transform general @atomic code"});
 }
 
+// Values are reduced over the work-group and its first item issues a single atomic:
+// `{ T r = sycl::reduce_over_group(g, value, op); if (id == 0) { atomic_ref(t) op= r; } }`
+bool tryReduceOverGroup(SessionStage& stage, const Stmt& stmt, const Attr& attr) {
+    if (!stage.getSession().getInput().reduceUniformAtomics) {
+        return false;
+    }
+    auto reduction = matchAtomicReduction(stage, stmt, attr);
+    if (!reduction) {
+        return false;
+    }
+
+    auto& ctx = stage.getCompiler().getASTContext();
+    const auto& type = reduction->type;
+    auto reduceOp = GROUP_REDUCE_OPS.at(reduction->combineOp) + "<" + type + ">()";
+    auto value = "static_cast<" + type + ">(" + getSourceText(*reduction->value, ctx) + ")";
+    auto op = BinaryOperator::getOpcodeStr(reduction->op).str();
+
+    std::string code = "{\n";
+    code += type + " _occa_reduce = sycl::reduce_over_group(item_.get_group(), " + value + ", " +
+            reduceOp + ");\n";
+    code += "if (item_.get_local_linear_id() == 0) {\n";
+    code += getAtomicRefStr(stage, *reduction->target, type) + "(" +
+            getSourceText(*reduction->target, ctx) + ") " + op + " _occa_reduce;\n";
+    code += "}\n";
+    code += "}";
+
+    stage.getRewriter().ReplaceText(reduction->range, code);
+    return true;
+}
+
 HandleResult handleAtomicAttribute(SessionStage& stage,
                                    const clang::Stmt& stmt,
                                    const clang::Attr& attr) {
+    if (tryReduceOverGroup(stage, stmt, attr)) {
+        return {};
+    }
+
     auto& ctx = stage.getCompiler().getASTContext();
     auto newExpression = buildNewExpression(stage, attr, stmt);
     if (!newExpression) {
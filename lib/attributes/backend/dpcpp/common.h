@@ -21,4 +21,6 @@ std::string buildInnerOuterLoopIdxLine(const OklLoopInfo& forLoop,
                                        oklt::Rewriter& rewriter);
 
 const std::string SYNC_THREADS_BARRIER = "item_.barrier(sycl::access::fence_space::local_space)";
+// Makes global memory writes of the work-group visible as well, e.g. between fused @outer loops
+const std::string GLOBAL_BARRIER = "item_.barrier(sycl::access::fence_space::global_and_local)";
 }  // namespace oklt::dpcpp
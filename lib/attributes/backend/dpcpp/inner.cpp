@@ -39,7 +39,7 @@ HandleResult handleInnerAttribute(SessionStage& s,
         *loopInfo, updatedParams, openedScopeCounter, s.getRewriter());
     auto suffixCode = buildCloseScopes(openedScopeCounter);
     std::string afterRBraceCode = "";
-    if (loopInfo->shouldSync()) {
+    if (shouldSyncAfterLoop(s, *loopInfo)) {
         afterRBraceCode += dpcpp::SYNC_THREADS_BARRIER + ";\n";
     }
 
@@ -2,18 +2,22 @@
 #include "util/string_utils.hpp"
 
 #include "attributes/attribute_names.h"
+#include "attributes/backend/dpcpp/common.h"
 #include "attributes/utils/kernel_utils.h"
 #include "core/handler_manager/backend_handler.h"
 #include "core/rewriter/rewriter_proxy.h"
 #include "core/sema/okl_sema_ctx.h"
 #include "core/sema/okl_sema_info.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
 #include "core/utils/attributes.h"
 #include "core/utils/type_converter.h"
 #include "pipeline/core/error_codes.h"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+
 namespace {
 using namespace oklt;
 using namespace clang;
@@ -24,7 +28,9 @@ const std::string SIMD_LEGHT_FMT = "[[intel::reqd_sub_group_size({})]]";
 const std::string SUBMIT_QUEUE =
     R"(queue_->submit(
     [&](sycl::handler & handler_) {
-      handler_.parallel_for(
+)";
+const std::string PARALLEL_FOR =
+    R"(      handler_.parallel_for(
         *range_,
         [=](sycl::nd_item<3> item_))";
 const std::string suffixCode =
@@ -66,7 +72,21 @@ std::string getFunctionAttributesStr([[maybe_unused]] const FunctionDecl& func,
     return out.str();
 }
 
-std::string getFunctionParamStr(const FunctionDecl& func, KernelInfo& kernelInfo, oklt::Rewriter& r) {
+void mergeFusedMetadata(KernelInfo& meta, const OklLoopInfo& info) {
+    meta.sharedPadding.insert(info.sharedPadding.begin(), info.sharedPadding.end());
+    if (info.coalescing) {
+        auto& coalescing = meta.coalescing ? *meta.coalescing : meta.coalescing.emplace();
+        coalescing.coalesced += info.coalescing->coalesced;
+        coalescing.strided += info.coalescing->strided;
+        coalescing.scattered += info.coalescing->scattered;
+    }
+    meta.fusedOuterLoops = std::max<size_t>(meta.fusedOuterLoops, 1) + 1;
+}
+
+std::string getFunctionParamStr(const FunctionDecl& func,
+                                KernelInfo& kernelInfo,
+                                size_t droppedParams,
+                                oklt::Rewriter& r) {
     std::stringstream out;
 
     kernelInfo.args.clear();
@@ -87,7 +107,7 @@ std::string getFunctionParamStr(const FunctionDecl& func, KernelInfo& kernelInfo
                      .name = "range_",
                      .is_ptr = true});
     out << util::fmt("{} {} {}", "sycl::nd_range<3>", "*", "range_").value();
-    if (func.getNumParams() > 0) {
+    if (func.getNumParams() > droppedParams) {
         out << ", ";
     }
 
@@ -123,8 +143,15 @@ HandleResult handleKernelAttribute(SessionStage& s,
     auto& kernels = sema.getProgramMetaData().kernels;
 
     auto oklKernelInfo = KernelInfo{.name = func.getNameAsString()};
+    applyReadOnlyParams(s, kernelInfo);
+    applyConstantParams(s, kernelInfo);
+
     auto typeStr = rewriter.getRewrittenText(func.getReturnTypeSourceRange());
-    auto paramStr = getFunctionParamStr(func, oklKernelInfo, rewriter);
+    auto droppedParams =
+        s.getSession().getInput().dropConstantArgs ? kernelInfo.constantParams.size() : 0;
+    auto paramStr = getFunctionParamStr(func, oklKernelInfo, droppedParams, rewriter);
+    markReadOnlyArgs(kernelInfo, oklKernelInfo);
+    dropConstantArgs(s, kernelInfo, oklKernelInfo);
 
     if (auto verified = verifyLoops(s, kernelInfo); !verified) {
         return tl::make_unexpected(std::move(verified.error()));
@@ -132,13 +159,31 @@ HandleResult handleKernelAttribute(SessionStage& s,
 
     size_t n = 0;
     auto startPos = getAttrFullSourceRange(a).getBegin();
-    for (auto* child : kernelInfo.topLevelOuterLoops) {
+    auto variantSuffix = getKernelVariantSuffix(s);
+    auto& loops = kernelInfo.topLevelOuterLoops;
+    for (auto it = loops.begin(); it != loops.end(); ++it) {
+        auto* child = *it;
         if (!child) {
             continue;
         }
+        if (child->fusedWithPrevious && n != 0) {
+            handleChildAttr(s, child->stmt, MAX_INNER_DIMS_NAME);
+            mergeFusedMetadata(kernels.back(), *child);
+
+            // Work-group finishes the previous loop before the next one reads its results
+            auto endPos = getAttrFullSourceRange(*child->attr).getBegin().getLocWithOffset(-1);
+            rewriter.ReplaceText(SourceRange{startPos, endPos},
+                                 "\n" + dpcpp::GLOBAL_BARRIER + ";\n");
+
+            auto body = dyn_cast_or_null<CompoundStmt>(child->stmt.getBody());
+            startPos = (body ? body->getEndLoc() : child->stmt.getRParenLoc()).getLocWithOffset(1);
+            continue;
+        }
         kernels.push_back(oklKernelInfo);
         auto& meta = kernels.back();
-        meta.name = getFunctionName(func, n);
+        meta.name = getFunctionName(func, n) + variantSuffix;
+        meta.sharedPadding = child->sharedPadding;
+        meta.coalescing = child->coalescing;
 
         handleChildAttr(s, child->stmt, MAX_INNER_DIMS_NAME);
 
@@ -148,8 +193,19 @@ HandleResult handleKernelAttribute(SessionStage& s,
             out << "}\n\n";
         }
         out << getFunctionAttributesStr(func, child);
-        out << typeStr << " " << getFunctionName(func, n) << paramStr << " {\n";
-        out << SUBMIT_QUEUE << genFunctionSimdLengthStr(func, child) << " {\n";
+        out << typeStr << " " << meta.name << paramStr << " {\n";
+        out << SUBMIT_QUEUE;
+        // Local memory of loops fused into the kernel is allocated by the same command group
+        for (auto fused = it; fused != loops.end(); ++fused) {
+            if (!*fused || (fused != it && !(*fused)->fusedWithPrevious)) {
+                break;
+            }
+            for (const auto& accessor : (*fused)->localAccessors) {
+                out << accessor << "\n";
+            }
+        }
+        out << PARALLEL_FOR << genFunctionSimdLengthStr(func, child) << " {\n";
+        out << getConstantParamsDecl(kernelInfo);
 
         auto endPos = getAttrFullSourceRange(*child->attr).getBegin().getLocWithOffset(-1);
         rewriter.ReplaceText(SourceRange{startPos, endPos}, out.str());
@@ -1,24 +1,105 @@
 #include "attributes/attribute_names.h"
 #include "attributes/utils/default_handlers.h"
+#include "attributes/utils/shared_padding.h"
 #include "core/handler_manager/backend_handler.h"
 #include "core/sema/okl_sema_ctx.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
 #include "core/utils/attributes.h"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+
 namespace {
 using namespace oklt;
 using namespace clang;
 
+// Accessors of the top-level @outer loops, that are fused into the kernel before this one, are
+// declared in the same command group
+std::vector<const OklLoopInfo*> getFusedPredecessors(SessionStage& s, const OklLoopInfo& outer) {
+    std::vector<const OklLoopInfo*> predecessors;
+    auto* kernelInfo = s.tryEmplaceUserCtx<OklSemaCtx>().getParsingKernelInfo();
+    if (!kernelInfo || !outer.fusedWithPrevious) {
+        return predecessors;
+    }
+    const auto& loops = kernelInfo->topLevelOuterLoops;
+    auto it = std::find(loops.begin(), loops.end(), &outer);
+    while (it != loops.end() && it != loops.begin() && *it && (*it)->fusedWithPrevious) {
+        --it;
+        if (*it) {
+            predecessors.push_back(*it);
+        }
+    }
+    return predecessors;
+}
+
+// Variable is declared as a view of one dimensional accessor of the kernel submission:
+// `sycl::local_accessor<T, 1> acc(sycl::range<1>(N), handler_);` and
+// `auto& x = *reinterpret_cast<T (*)[E0][E1]>(&acc[0]);`
+std::optional<std::string> lowerToLocalAccessor(SessionStage& s,
+                                                const VarDecl& var,
+                                                const QualType& type,
+                                                OklLoopInfo& outer) {
+    auto& ctx = s.getCompiler().getASTContext();
+    size_t count = 1;
+    auto elemType = type;
+    while (const auto* arrayType = ctx.getAsArrayType(elemType)) {
+        const auto* constArray = dyn_cast<ConstantArrayType>(arrayType);
+        if (!constArray) {
+            return std::nullopt;
+        }
+        count *= constArray->getSize().getZExtValue();
+        elemType = arrayType->getElementType();
+    }
+
+    auto groupLoops = getFusedPredecessors(s, outer);
+    groupLoops.push_back(&outer);
+    size_t nAccessors = 0;
+    for (const auto* loop : groupLoops) {
+        nAccessors += loop->localAccessors.size();
+    }
+
+    auto varName = var.getNameAsString();
+    auto accessorName = "_occa_local_" + varName;
+    auto isTaken = [&](const std::string& name) {
+        return std::any_of(groupLoops.begin(), groupLoops.end(), [&](const OklLoopInfo* loop) {
+            return std::any_of(loop->localAccessors.begin(),
+                               loop->localAccessors.end(),
+                               [&](const std::string& decl) {
+                                   return decl.find(" " + name + "(") != std::string::npos;
+                               });
+        });
+    };
+    if (isTaken(accessorName)) {
+        accessorName += "_" + std::to_string(nAccessors);
+    }
+
+    auto& policy = ctx.getPrintingPolicy();
+    outer.localAccessors.push_back(
+        util::fmt("sycl::local_accessor<{}, 1> {}(sycl::range<1>({}), handler_);",
+                  elemType.getDesugaredType(ctx).getAsString(policy),
+                  accessorName,
+                  count)
+            .value());
+
+    if (!ctx.getAsArrayType(type)) {
+        return util::fmt("auto & {} = {}[0]", varName, accessorName).value();
+    }
+    return util::fmt("auto & {} = *reinterpret_cast<{}>(&{}[0])",
+                     varName,
+                     ctx.getPointerType(type).getAsString(policy),
+                     accessorName)
+        .value();
+}
+
 // TODO: There is no TypeDecl handler in DPCPP backend
 HandleResult handleSharedAttribute(SessionStage& s, const VarDecl& var, const Attr& a) {
     SPDLOG_DEBUG("Handle [@shared] attribute");
 
     auto varName = var.getNameAsString();
     // Desugar since it is attributed (since it is @shared variable)
-    auto typeStr =
-        QualType(var.getType().getTypePtr()->getUnqualifiedDesugaredType(), 0).getAsString();
+    auto type = QualType(var.getType().getTypePtr()->getUnqualifiedDesugaredType(), 0);
 
     auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
     auto loopInfo = sema.getLoopInfo();
@@ -36,6 +117,15 @@ HandleResult handleSharedAttribute(SessionStage& s, const VarDecl& var, const At
             Error{{}, "Must define [@shared] variables between [@outer] and [@inner] loops"});
     }
 
+    if (!type->isDependentType()) {
+        auto padding = getSharedBankPadding(s, var, a, *loopInfo);
+        if (padding) {
+            type = getPaddedSharedType(s.getCompiler().getASTContext(), type, padding);
+            loopInfo->getAttributedRoot()->sharedPadding[varName] = padding;
+        }
+    }
+    auto typeStr = type.getAsString();
+
     auto newDeclaration =
         util::fmt(
             "auto & {} = "
@@ -44,6 +134,18 @@ HandleResult handleSharedAttribute(SessionStage& s, const VarDecl& var, const At
             typeStr)
             .value();
 
+    if (s.getSession().getInput().localAccessorShared && !type->isDependentType()) {
+        // Accessors are declared per kernel split, so they are stored in its top-level @outer loop
+        auto accessorDeclaration =
+            lowerToLocalAccessor(s, var, type, *loopInfo->getAttributedRoot());
+        if (accessorDeclaration) {
+            newDeclaration = *accessorDeclaration;
+        } else {
+            s.pushWarning("[@shared] variable '" + varName +
+                          "' of runtime size is kept in group local memory");
+        }
+    }
+
     SourceRange range(getAttrFullSourceRange(a).getBegin(), var.getSourceRange().getEnd());
 
     s.getRewriter().ReplaceText(range, newDeclaration);
@@ -247,13 +247,13 @@ HandleResult handleTileAttribute(SessionStage& s,
     auto prefixCode =
         buildPreffixTiledCode(*loopInfo, &updatedParams, openedScopeCounter, s.getRewriter());
     auto suffixCode = buildCloseScopes(openedScopeCounter);
+    handleChildAttr(s, forStmt, NO_BARRIER_ATTR_NAME);
+
     std::string afterRBraceCode = "";
-    if (loopInfo->shouldSync()) {
+    if (shouldSyncAfterLoop(s, *loopInfo)) {
         afterRBraceCode += dpcpp::SYNC_THREADS_BARRIER + ";";
     }
 
-    handleChildAttr(s, forStmt, NO_BARRIER_ATTR_NAME);
-
     return replaceAttributedLoop(s, forStmt, a, suffixCode, afterRBraceCode, prefixCode, false);
 }
 
@@ -7,6 +7,7 @@
 #include "core/sema/okl_sema_ctx.h"
 #include "core/sema/okl_sema_info.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
 #include "core/utils/attributes.h"
 #include "core/utils/range_to_string.h"
 #include "core/utils/type_converter.h"
@@ -336,12 +337,19 @@ std::string getRootLoopBody(SessionStage& s,
     out << "kernel";
     out << "(";
     {
-        for (auto it = decl.param_begin(), end = decl.param_end(); it != end; ++it) {
-            auto* param = *it;
-            if (!param) {
+        // Arguments bound to compile-time values are dropped from device kernels
+        const auto* kernelInfo = s.tryEmplaceUserCtx<OklSemaCtx>().getParsingKernelInfo();
+        auto isDropped = [&](const ParmVarDecl* param) {
+            return s.getSession().getInput().dropConstantArgs && kernelInfo &&
+                   kernelInfo->constantParams.count(param) != 0;
+        };
+        bool isFirst = true;
+        for (const auto* param : decl.parameters()) {
+            if (!param || isDropped(param)) {
                 continue;
             }
-            out << (it != decl.param_begin() ? ", " : "") << param->getNameAsString();
+            out << (isFirst ? "" : ", ") << param->getNameAsString();
+            isFirst = false;
         }
     }
     out << ");\n";
@@ -400,6 +408,12 @@ HandleResult handleLauncherKernelAttribute(SessionStage& s,
         }
         removeAttribute(s, *loop->attr);
 
+        // Loop runs in the device kernel launched for the previous one
+        if (loop->fusedWithPrevious && n != 0) {
+            rewriter.RemoveText(SourceRange{loop->stmt.getForLoc(), loop->stmt.getEndLoc()});
+            continue;
+        }
+
         auto body = getRootLoopBody(s, func, *loop, n);
         // NOTE: rewriter order matter! First get body, then remove, otherwise UB !!!
         rewriter.RemoveText(SourceRange{loop->stmt.getForLoc(), loop->stmt.getRParenLoc()});
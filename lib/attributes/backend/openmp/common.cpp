@@ -0,0 +1,272 @@
+#include "attributes/backend/openmp/common.h"
+#include "attributes/utils/kernel_utils.h"
+#include "core/transpiler_session/transpiler_session.h"
+#include "core/utils/loop_dependencies.h"
+#include "core/utils/range_to_string.h"
+
+#include <sstream>
+
+namespace oklt::openmp {
+using namespace clang;
+
+namespace {
+// INFO: attribute is only parsed, it is removed by its own handler
+std::optional<ScheduleInfo> parseScheduleAttr(SessionStage& s, const ForStmt& stmt) {
+    auto* attributedStmt = getAttributedStmt(s, stmt);
+    if (!attributedStmt) {
+        return std::nullopt;
+    }
+
+    for (const auto* attr : attributedStmt->getAttrs()) {
+        if (!attr || attr->getNormalizedFullName() != SCHEDULE_ATTR_NAME) {
+            continue;
+        }
+        auto params = s.getAttrManager().parseAttr(s, *attr);
+        if (!params || params->type() != typeid(AttributedLoopSchedule)) {
+            return std::nullopt;
+        }
+        return std::any_cast<AttributedLoopSchedule>(params.value()).policy;
+    }
+
+    return std::nullopt;
+}
+
+const ForStmt* getForStmt(const Stmt* stmt) {
+    if (const auto* attributed = dyn_cast_or_null<AttributedStmt>(stmt)) {
+        stmt = attributed->getSubStmt();
+    }
+    return dyn_cast_or_null<ForStmt>(stmt);
+}
+
+bool isBodyOfOuterLoopsOnly(const OklKernelInfo& kernelInfo) {
+    const auto* body = dyn_cast_or_null<CompoundStmt>(kernelInfo.decl.get().getBody());
+    if (!body) {
+        return false;
+    }
+
+    auto it = kernelInfo.topLevelOuterLoops.begin();
+    for (const auto* child : body->body()) {
+        if (isa<NullStmt>(child)) {
+            continue;
+        }
+        if (it == kernelInfo.topLevelOuterLoops.end() || !*it ||
+            getForStmt(child) != &(*it)->stmt) {
+            return false;
+        }
+        ++it;
+    }
+    return it == kernelInfo.topLevelOuterLoops.end();
+}
+
+std::vector<bool> getNowaitLoops(const std::vector<StmtAccessInfo>& accesses) {
+    auto n = accesses.size();
+    std::vector<bool> nowait(n, false);
+    if (n < 2) {
+        return nowait;
+    }
+
+    // Walk backwards: without barrier after loop k, it runs concurrently with every next loop up to
+    // the first one that is followed by barrier, all of them must be independent of loop k
+    for (size_t k = n - 1; k-- > 0;) {
+        bool independent = true;
+        for (size_t j = k + 1; j < n && independent; ++j) {
+            independent = areStmtsIndependent(accesses[k], accesses[j]);
+            if (!nowait[j]) {
+                break;
+            }
+        }
+        nowait[k] = independent;
+    }
+    return nowait;
+}
+
+std::string getScheduleClause(const ScheduleInfo& schedule) {
+    if (schedule.kind == ScheduleKind::Default) {
+        return "";
+    }
+    std::stringstream out;
+    out << " schedule(" << toString(schedule.kind);
+    if (schedule.chunk > 0) {
+        out << ", " << schedule.chunk;
+    }
+    out << ")";
+    return out.str();
+}
+
+std::string getTeamClauses(const ScheduleInfo& schedule) {
+    std::stringstream out;
+    if (schedule.procBind != ProcBind::Default) {
+        out << " proc_bind(" << toString(schedule.procBind) << ")";
+    }
+    if (schedule.numThreads > 0) {
+        out << " num_threads(" << schedule.numThreads << ")";
+    }
+    return out.str();
+}
+
+// Range of the loop must be computable outside of the kernel body: only params and globals
+bool isRangeOfParamsOnly(const Stmt* stmt) {
+    if (!stmt) {
+        return true;
+    }
+    if (const auto* ref = dyn_cast<DeclRefExpr>(stmt)) {
+        const auto* var = dyn_cast<VarDecl>(ref->getDecl());
+        if (var && !isa<ParmVarDecl>(var) && var->isLocalVarDeclOrParm()) {
+            return false;
+        }
+    }
+    for (const auto* child : stmt->children()) {
+        if (!isRangeOfParamsOnly(child)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string getTripCountStr(const OklLoopInfo& loop, oklt::Rewriter& rewriter) {
+    auto start = "(" + getLatestSourceText(loop.range.start, rewriter) + ")";
+    auto end = "(" + getLatestSourceText(loop.range.end, rewriter) + ")";
+    auto step = loop.isUnary() ? std::string("(1)")
+                               : "(" + getLatestSourceText(loop.inc.val, rewriter) + ")";
+    auto inclusive = loop.condition.op == BinOp::Le || loop.condition.op == BinOp::Ge;
+
+    auto distance = loop.IsInc() ? end + " - " + start : start + " - " + end;
+    return "(" + distance + " + " + step + (inclusive ? "" : " - 1") + ") / " + step;
+}
+}  // namespace
+
+ScheduleInfo getSchedule(SessionStage& s, const OklLoopInfo& loopInfo) {
+    if (loopInfo.schedule) {
+        return loopInfo.schedule.value();
+    }
+    if (auto schedule = parseScheduleAttr(s, loopInfo.stmt)) {
+        return schedule.value();
+    }
+
+    const auto& input = s.getSession().getInput();
+    auto schedule = input.ompSchedule;
+    // Deterministic partition, so pages touched by `_occa_first_touch_*` kernel stay local.
+    // Kind chosen by the user is kept, the first-touch kernel is skipped with a warning then
+    if (input.numaPartition) {
+        if (schedule.kind == ScheduleKind::Default) {
+            schedule.kind = ScheduleKind::Static;
+            schedule.chunk = -1;
+        }
+        if (schedule.procBind == ProcBind::Default) {
+            schedule.procBind = ProcBind::Spread;
+        }
+    }
+    return schedule;
+}
+
+std::optional<ParallelRegion> getParallelRegion(SessionStage& s, const OklKernelInfo& kernelInfo) {
+    if (kernelInfo.topLevelOuterLoops.size() < 2 || !isBodyOfOuterLoopsOnly(kernelInfo)) {
+        return std::nullopt;
+    }
+
+    ParallelRegion region;
+    std::vector<StmtAccessInfo> accesses;
+    for (const auto* loop : kernelInfo.topLevelOuterLoops) {
+        auto schedule = getSchedule(s, *loop);
+        if (accesses.empty()) {
+            region.policy.procBind = schedule.procBind;
+            region.policy.numThreads = schedule.numThreads;
+        } else if (region.policy.procBind != schedule.procBind ||
+                   region.policy.numThreads != schedule.numThreads) {
+            return std::nullopt;
+        }
+        accesses.push_back(collectStmtAccesses(loop->stmt));
+    }
+
+    region.nowait = getNowaitLoops(accesses);
+    return region;
+}
+
+std::string buildParallelForPragma(SessionStage& s, const ForStmt& stmt) {
+    auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
+    auto loopInfo = sema.getLoopInfo(stmt);
+    if (!loopInfo) {
+        return "\n#pragma omp parallel for\n";
+    }
+
+    auto schedule = getSchedule(s, *loopInfo);
+    auto* kernelInfo = sema.getParsingKernelInfo();
+    auto region = kernelInfo ? getParallelRegion(s, *kernelInfo) : std::nullopt;
+    if (!region) {
+        return "\n#pragma omp parallel for" + getScheduleClause(schedule) +
+               getTeamClauses(schedule) + "\n";
+    }
+
+    size_t n = 0;
+    for (const auto* loop : kernelInfo->topLevelOuterLoops) {
+        if (loop == loopInfo) {
+            break;
+        }
+        ++n;
+    }
+
+    auto nowait = n < region->nowait.size() && region->nowait[n];
+    return "\n#pragma omp for" + getScheduleClause(schedule) + (nowait ? " nowait" : "") + "\n";
+}
+
+std::string buildParallelRegionPragma(const ParallelRegion& region) {
+    return "\n#pragma omp parallel" + getTeamClauses(region.policy) + "\n";
+}
+
+std::string getFirstTouchKernelName(const std::string& kernelName) {
+    return "_occa_first_touch_" + kernelName;
+}
+
+std::optional<std::string> buildFirstTouchKernel(SessionStage& s,
+                                                 const OklKernelInfo& kernelInfo) {
+    if (!s.getSession().getInput().numaPartition || kernelInfo.topLevelOuterLoops.empty()) {
+        return std::nullopt;
+    }
+
+    // Pages are distributed the same way as iterations of the first top-level loop
+    const auto* loop = kernelInfo.topLevelOuterLoops.front();
+    if (!loop || !isRangeOfParamsOnly(loop->range.start) || !isRangeOfParamsOnly(loop->range.end) ||
+        !isRangeOfParamsOnly(loop->inc.val)) {
+        return std::nullopt;
+    }
+
+    // Only static schedule assigns the same iterations to the same threads for equal trip count
+    auto schedule = getSchedule(s, *loop);
+    if (schedule.kind != ScheduleKind::Static) {
+        s.pushWarning("NUMA partition of kernel '" + kernelInfo.decl.get().getNameAsString() +
+                      "' requires static schedule, first-touch kernel is not generated");
+        return std::nullopt;
+    }
+
+    const auto& func = kernelInfo.decl.get();
+    auto& policy = s.getCompiler().getASTContext().getPrintingPolicy();
+    std::string params;
+    for (const auto* param : func.parameters()) {
+        auto type = param->getType();
+        params += type.getAsString(policy) + (type->isPointerType() ? " " : " &") +
+                  param->getNameAsString() + ", ";
+    }
+    params += "void* _occa_buffer, const size_t& _occa_bytes";
+
+    std::stringstream out;
+    out << "\n\nextern \"C\" void " << getFirstTouchKernelName(func.getNameAsString()) << "("
+        << params << ") {\n"
+        << "const long long _occa_iters = " << getTripCountStr(*loop, s.getRewriter()) << ";\n"
+        << "#pragma omp parallel for" << getScheduleClause(schedule) << getTeamClauses(schedule)
+        << "\n"
+        << "for (long long _occa_it = 0; _occa_it < _occa_iters; ++_occa_it) {\n"
+        // INFO: `_occa_bytes * _occa_it` can overflow, bytes are split as quotient and remainder
+        << "const size_t _occa_chunk = _occa_bytes / _occa_iters;\n"
+        << "const size_t _occa_rest = _occa_bytes % _occa_iters;\n"
+        << "const size_t _occa_index = _occa_it;\n"
+        << "const size_t _occa_begin = _occa_chunk * _occa_index + "
+           "(_occa_index < _occa_rest ? _occa_index : _occa_rest);\n"
+        << "const size_t _occa_end = _occa_begin + _occa_chunk + "
+           "(_occa_index < _occa_rest ? 1 : 0);\n"
+        << "std::memset(static_cast<char*>(_occa_buffer) + _occa_begin, 0, _occa_end - "
+           "_occa_begin);\n"
+        << "}\n"
+        << "}\n";
+    return out.str();
+}
+}  // namespace oklt::openmp
@@ -8,3 +8,52 @@
 #include "core/sema/okl_sema_ctx.h"
 #include "core/transpiler_session/session_stage.h"
 #include "core/utils/attributes.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace oklt::openmp {
+/**
+ * @brief Single `#pragma omp parallel` region around all top-level @outer loops of the kernel.
+ */
+struct ParallelRegion {
+    ScheduleInfo policy;       ///< proc_bind and num_threads of the region.
+    std::vector<bool> nowait;  ///< Per top-level @outer loop: the barrier after it can be skipped.
+};
+
+/**
+ * @brief Resolves OpenMP policy of the loop: @schedule if present, otherwise user default.
+ */
+ScheduleInfo getSchedule(SessionStage& s, const OklLoopInfo& loopInfo);
+
+/**
+ * @brief Checks if the top-level @outer loops of the kernel can share one parallel region: kernel
+ * body consists of two or more top-level @outer loops only, and all of them have the same
+ * proc_bind and num_threads.
+ */
+std::optional<ParallelRegion> getParallelRegion(SessionStage& s, const OklKernelInfo& kernelInfo);
+
+/**
+ * @brief Builds `#pragma omp parallel for`, or `#pragma omp for` inside of the parallel region,
+ * with clauses of the top-level @outer loop policy.
+ */
+std::string buildParallelForPragma(SessionStage& s, const clang::ForStmt& stmt);
+
+/**
+ * @brief Builds `#pragma omp parallel` line of the region.
+ */
+std::string buildParallelRegionPragma(const ParallelRegion& region);
+
+/**
+ * @brief Name of the first-touch companion of the kernel.
+ */
+std::string getFirstTouchKernelName(const std::string& kernelName);
+
+/**
+ * @brief Builds the first-touch companion kernel: zeroes a buffer by slices under the same static
+ * partition and thread binding as the first top-level @outer loop of the kernel. Emitted only with
+ * `UserInput::numaPartition` and when the loop range depends on kernel params only.
+ */
+std::optional<std::string> buildFirstTouchKernel(SessionStage& s, const OklKernelInfo& kernelInfo);
+}  // namespace oklt::openmp
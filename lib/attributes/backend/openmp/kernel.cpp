@@ -1,14 +1,73 @@
 #include "attributes/backend/openmp/common.h"
+#include "core/transpiler_session/header_info.h"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+
 namespace {
 using namespace oklt;
 using namespace clang;
 
+const std::string firstTouchHeader = "#include <cstring>\n";
+
+void addFirstTouchHeader(SessionStage& s) {
+    auto& headers = s.tryEmplaceUserCtx<HeaderDepsInfo>().backendHeaders;
+    if (std::find(headers.begin(), headers.end(), firstTouchHeader) == headers.end()) {
+        headers.push_back(firstTouchHeader);
+    }
+}
+
+HandleResult handleOPENMPKernelAttribute(SessionStage& s, const FunctionDecl& func, const Attr& a) {
+    auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
+    auto* kernelInfo = sema.getParsingKernelInfo();
+
+    auto result = serial_subset::handleKernelAttribute(s, func, a);
+    if (!result || !kernelInfo) {
+        return result;
+    }
+
+    // Record OpenMP policy of every top-level @outer loop, omitted if all of them are default
+    std::vector<ScheduleInfo> schedules;
+    bool isDefault = true;
+    for (const auto* loop : kernelInfo->topLevelOuterLoops) {
+        if (!loop) {
+            continue;
+        }
+        schedules.push_back(openmp::getSchedule(s, *loop));
+        isDefault = isDefault && schedules.back().empty();
+    }
+
+    auto& kernels = sema.getProgramMetaData().kernels;
+    if (!isDefault && !kernels.empty()) {
+        kernels.back().schedules = std::move(schedules);
+    }
+
+    // NUMA first-touch companion goes right after the kernel
+    if (auto firstTouch = openmp::buildFirstTouchKernel(s, *kernelInfo)) {
+        s.getRewriter().InsertTextAfterToken(func.getEndLoc(), firstTouch.value());
+        addFirstTouchHeader(s);
+        if (!kernels.empty()) {
+            kernels.back().firstTouch = openmp::getFirstTouchKernelName(func.getNameAsString());
+        }
+    }
+
+    // Phases of the kernel share one thread team, see `openmp::buildParallelForPragma`
+    auto region = openmp::getParallelRegion(s, *kernelInfo);
+    auto body = dyn_cast_or_null<CompoundStmt>(func.getBody());
+    if (region && body) {
+        auto& rewriter = s.getRewriter();
+        rewriter.InsertTextAfterToken(body->getLBracLoc(),
+                                      openmp::buildParallelRegionPragma(region.value()) + "{\n");
+        rewriter.InsertTextBefore(body->getRBracLoc(), "}\n");
+    }
+
+    return result;
+}
+
 __attribute__((constructor)) void registerOPENMPKernelHandler() {
     auto ok = registerBackendHandler(
-        TargetBackend::OPENMP, KERNEL_ATTR_NAME, serial_subset::handleKernelAttribute);
+        TargetBackend::OPENMP, KERNEL_ATTR_NAME, handleOPENMPKernelAttribute);
 
     if (!ok) {
         SPDLOG_ERROR("[OPENMP] Failed to register {} attribute handler", KERNEL_ATTR_NAME);
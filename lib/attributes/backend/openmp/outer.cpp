@@ -6,8 +6,6 @@ namespace {
 using namespace oklt;
 using namespace clang;
 
-const std::string prefixText = "\n#pragma omp parallel for\n";
-
 HandleResult handleOPENMPOuterAttribute(SessionStage& s,
                                         const ForStmt& stmt,
                                         const Attr& a,
@@ -21,6 +19,7 @@ HandleResult handleOPENMPOuterAttribute(SessionStage& s,
     // Top level `@outer` loop
     auto parent = loopInfo->getAttributedParent();
     if (!parent && loopInfo->has(LoopType::Outer)) {
+        auto prefixText = openmp::buildParallelForPragma(s, stmt);
         s.getRewriter().InsertText(stmt.getBeginLoc(), prefixText, false, true);
     }
 
@@ -6,8 +6,6 @@ namespace {
 using namespace oklt;
 using namespace clang;
 
-const std::string prefixText = "\n#pragma omp parallel for\n";
-
 HandleResult handleOPENMPTileAttribute(SessionStage& s,
                                        const ForStmt& stmt,
                                        const Attr& a,
@@ -19,12 +17,21 @@ HandleResult handleOPENMPTileAttribute(SessionStage& s,
     }
 
     // Top level `@outer` loop
+    std::string remainderPrefix;
     auto parent = loopInfo->getAttributedParent();
     if (!parent && loopInfo->has(LoopType::Outer)) {
+        auto prefixText = openmp::buildParallelForPragma(s, stmt);
         s.getRewriter().InsertText(stmt.getBeginLoc(), prefixText, false, true);
+
+        // Peeled remainder tile is placed before `#pragma omp for`, inside of the shared parallel
+        // region it must be executed by a single thread
+        auto* kernelInfo = sema.getParsingKernelInfo();
+        if (kernelInfo && openmp::getParallelRegion(s, *kernelInfo)) {
+            remainderPrefix = "#pragma omp single nowait\n";
+        }
     }
 
-    return serial_subset::handleTileAttribute(s, stmt, a, params);
+    return serial_subset::handleTileAttribute(s, stmt, a, params, remainderPrefix);
 }
 
 __attribute__((constructor)) void registerOPENMPSharedHandler() {
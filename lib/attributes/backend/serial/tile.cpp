@@ -6,9 +6,16 @@ namespace {
 using namespace oklt;
 using namespace clang;
 
+HandleResult handleSerialTileAttribute(SessionStage& s,
+                                       const ForStmt& stmt,
+                                       const Attr& a,
+                                       const TileParams* params) {
+    return serial_subset::handleTileAttribute(s, stmt, a, params);
+}
+
 __attribute__((constructor)) void registerOPENMPSharedHandler() {
-    auto ok = registerBackendHandler(
-        TargetBackend::SERIAL, TILE_ATTR_NAME, serial_subset::handleTileAttribute);
+    auto ok =
+        registerBackendHandler(TargetBackend::SERIAL, TILE_ATTR_NAME, handleSerialTileAttribute);
 
     if (!ok) {
         SPDLOG_ERROR("[SERIAL] Failed to register {} attribute handler", TILE_ATTR_NAME);
@@ -0,0 +1,121 @@
+#include "attributes/backend/threads/common.h"
+#include "core/utils/range_to_string.h"
+#include "pipeline/core/error_codes.h"
+
+#include <spdlog/spdlog.h>
+
+#include <map>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+using BinOpMapT = std::map<BinaryOperatorKind, std::string>;
+using UnaryOpMapT = std::map<UnaryOperatorKind, std::string>;
+
+const std::string atomicBlockText =
+    "\nstd::lock_guard<std::mutex> _occa_atomic_lock(okl_threads::atomic_mutex());\n";
+
+const BinOpMapT atomicBinaryMap = {
+    {BinaryOperatorKind::BO_Assign, "store"},
+    {BinaryOperatorKind::BO_AddAssign, "fetch_add"},
+    {BinaryOperatorKind::BO_SubAssign, "fetch_sub"},
+    {BinaryOperatorKind::BO_AndAssign, "fetch_and"},
+    {BinaryOperatorKind::BO_OrAssign, "fetch_or"},
+    {BinaryOperatorKind::BO_XorAssign, "fetch_xor"},
+};
+
+const UnaryOpMapT atomicUnaryMap = {
+    {UnaryOperatorKind::UO_PreDec, "fetch_sub"},
+    {UnaryOperatorKind::UO_PostDec, "fetch_sub"},
+    {UnaryOperatorKind::UO_PreInc, "fetch_add"},
+    {UnaryOperatorKind::UO_PostInc, "fetch_add"},
+};
+
+HandleResult makeNotSupportedError(const std::string& exprStr) {
+    std::string description = "Atomic does not support this operation: " + exprStr;
+    return tl::make_unexpected(
+        Error{make_error_code(OkltPipelineErrorCode::ATOMIC_NOT_SUPPORTED_OP), description});
+}
+
+// `std::atomic_ref(x).op(value)`
+HandleResult replaceWithAtomicRef(SessionStage& s,
+                                  const Expr& target,
+                                  const std::string& method,
+                                  const std::string& value,
+                                  const Attr& a,
+                                  SourceLocation endLoc) {
+    auto& ctx = s.getCompiler().getASTContext();
+    if (!target.isLValue()) {
+        std::string description = getSourceText(target, ctx) + ": is not lvalue";
+        return tl::make_unexpected(
+            Error{make_error_code(OkltPipelineErrorCode::ATOMIC_NON_LVALUE_EXPR), description});
+    }
+
+    auto atomicOpText = "std::atomic_ref(" + getSourceText(target, ctx) + ")." + method + "(" +
+                        value + ")";
+    s.getRewriter().ReplaceText({getAttrFullSourceRange(a).getBegin(), endLoc}, atomicOpText);
+    return {};
+}
+
+HandleResult handleTHREADSAtomicAttribute(SessionStage& s, const Stmt& stmt, const Attr& a) {
+    SPDLOG_DEBUG("Handle [@atomic] attribute");
+
+    auto& ctx = s.getCompiler().getASTContext();
+    if (const auto binOp = dyn_cast<BinaryOperator>(&stmt)) {
+        auto it = atomicBinaryMap.find(binOp->getOpcode());
+        if (it == atomicBinaryMap.end()) {
+            return makeNotSupportedError(getSourceText(*binOp, ctx));
+        }
+        return replaceWithAtomicRef(s,
+                                    *binOp->getLHS(),
+                                    it->second,
+                                    getSourceText(*binOp->getRHS(), ctx),
+                                    a,
+                                    binOp->getEndLoc());
+    }
+
+    if (const auto unOp = dyn_cast<UnaryOperator>(&stmt)) {
+        auto it = atomicUnaryMap.find(unOp->getOpcode());
+        if (it == atomicUnaryMap.end()) {
+            return makeNotSupportedError(getSourceText(*unOp, ctx));
+        }
+        return replaceWithAtomicRef(s, *unOp->getSubExpr(), it->second, "1", a, unOp->getEndLoc());
+    }
+
+    if (const auto assignOp = dyn_cast<CXXOperatorCallExpr>(&stmt)) {
+        if (assignOp->getOperator() != OverloadedOperatorKind::OO_Equal ||
+            assignOp->getNumArgs() != 2) {
+            return makeNotSupportedError(getSourceText(*assignOp, ctx));
+        }
+        return replaceWithAtomicRef(s,
+                                    *assignOp->getArg(0),
+                                    atomicBinaryMap.at(BinaryOperatorKind::BO_Assign),
+                                    getSourceText(*assignOp->getArg(1), ctx),
+                                    a,
+                                    assignOp->getEndLoc());
+    }
+
+    // Block of statements is serialized with the runtime mutex
+    if (const auto compStmt = dyn_cast<CompoundStmt>(&stmt)) {
+        auto& rewriter = s.getRewriter();
+        rewriter.RemoveText(getAttrFullSourceRange(a));
+        rewriter.InsertTextAfterToken(compStmt->getLBracLoc(), atomicBlockText);
+        return {};
+    }
+
+    if (const auto expr = dyn_cast<Expr>(&stmt)) {
+        return makeNotSupportedError(getSourceText(*expr, ctx));
+    }
+    return makeNotSupportedError(getSourceText(stmt.getSourceRange(), ctx));
+}
+
+__attribute__((constructor)) void registerTHREADSAtomicHandler() {
+    auto ok = registerBackendHandler(
+        TargetBackend::THREADS, ATOMIC_ATTR_NAME, handleTHREADSAtomicAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("[THREADS] Failed to register {} attribute handler", ATOMIC_ATTR_NAME);
+    }
+}
+}  // namespace
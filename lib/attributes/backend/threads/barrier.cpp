@@ -0,0 +1,17 @@
+#include "attributes/backend/threads/common.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+__attribute__((constructor)) void registerTHREADSBarrierHandler() {
+    auto ok = registerBackendHandler(
+        TargetBackend::THREADS, BARRIER_ATTR_NAME, serial_subset::handleEmptyStmtAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("[THREADS] Failed to register {} attribute handler", BARRIER_ATTR_NAME);
+    }
+}
+}  // namespace
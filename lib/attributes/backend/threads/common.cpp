@@ -0,0 +1,121 @@
+#include "attributes/backend/threads/common.h"
+#include "core/utils/range_to_string.h"
+#include "util/string_utils.hpp"
+
+#include <clang/AST/StmtCXX.h>
+
+namespace oklt::threads {
+using namespace clang;
+
+namespace {
+// `continue` of nested loops and lambdas belongs to them
+void collectOwnContinues(const Stmt* stmt, std::vector<const ContinueStmt*>& out) {
+    if (!stmt) {
+        return;
+    }
+    if (auto continueStmt = dyn_cast<ContinueStmt>(stmt)) {
+        out.push_back(continueStmt);
+        return;
+    }
+    if (isa<ForStmt, WhileStmt, DoStmt, CXXForRangeStmt, LambdaExpr>(stmt)) {
+        return;
+    }
+    for (const auto* child : stmt->children()) {
+        collectOwnContinues(child, out);
+    }
+}
+
+// `return` of the kernel and `break` of the outlined loop would leave the lambda only
+const Stmt* findLeavingStmt(const Stmt* stmt, bool isInNestedLoop) {
+    if (!stmt || isa<LambdaExpr>(stmt)) {
+        return nullptr;
+    }
+    if (isa<ReturnStmt>(stmt) || (isa<BreakStmt>(stmt) && !isInNestedLoop)) {
+        return stmt;
+    }
+    isInNestedLoop =
+        isInNestedLoop || isa<ForStmt, WhileStmt, DoStmt, CXXForRangeStmt, SwitchStmt>(stmt);
+    for (const auto* child : stmt->children()) {
+        if (const auto* found = findLeavingStmt(child, isInNestedLoop)) {
+            return found;
+        }
+    }
+    return nullptr;
+}
+}  // namespace
+
+std::string buildParallelForHeader(const OklLoopInfo& loopInfo,
+                                   const std::string& var,
+                                   const std::string& start,
+                                   const std::string& end,
+                                   const std::string& step) {
+    auto endStr = end;
+    if (loopInfo.condition.op == BinOp::Le) {
+        endStr = util::fmt("({}) + 1", end).value();
+    } else if (loopInfo.condition.op == BinOp::Ge) {
+        endStr = util::fmt("({}) - 1", end).value();
+    }
+
+    return util::fmt("okl_threads::{}<{}>({}, {}, {}, [&]({} {})",
+                     loopInfo.IsInc() ? "parallel_for" : "parallel_for_reverse",
+                     loopInfo.var.typeName,
+                     start,
+                     endStr,
+                     step,
+                     loopInfo.var.typeName,
+                     var)
+        .value();
+}
+
+HandleResult outlineOuterLoop(SessionStage& s, const ForStmt& stmt, const OklLoopInfo& loopInfo) {
+    auto body = dyn_cast_or_null<CompoundStmt>(stmt.getBody());
+    if (!body) {
+        return tl::make_unexpected(
+            Error{{}, "[@outer] body of the top-level loop must be a compound statement"});
+    }
+
+    auto ok = checkOutlinedBody(*body, "[@outer]");
+    if (!ok) {
+        return ok;
+    }
+
+    auto& rewriter = s.getRewriter();
+    auto step =
+        loopInfo.isUnary() ? std::string("1") : getLatestSourceText(loopInfo.inc.val, rewriter);
+    auto header = buildParallelForHeader(loopInfo,
+                                         loopInfo.var.name,
+                                         getLatestSourceText(loopInfo.range.start, rewriter),
+                                         getLatestSourceText(loopInfo.range.end, rewriter),
+                                         step);
+
+    rewriter.ReplaceText(SourceRange{stmt.getForLoc(), stmt.getRParenLoc()}, header);
+    rewriter.InsertTextAfterToken(body->getRBracLoc(), parallelForSuffix);
+    replaceOutlinedContinues(s, *body);
+
+    return {};
+}
+
+HandleResult checkOutlinedBody(const Stmt& body, const std::string& attrName) {
+    const auto* leaving = findLeavingStmt(&body, false);
+    if (!leaving) {
+        return {};
+    }
+    auto keyword = isa<ReturnStmt>(leaving) ? "return" : "break";
+    auto desc = util::fmt("{} `{}` can't leave the top-level loop, that runs on the thread pool",
+                          attrName,
+                          keyword)
+                    .value();
+    return tl::make_unexpected(Error{{}, std::move(desc), leaving->getSourceRange()});
+}
+
+void replaceOutlinedContinues(SessionStage& s, const Stmt& body) {
+    std::vector<const ContinueStmt*> continues;
+    for (const auto* child : body.children()) {
+        collectOwnContinues(child, continues);
+    }
+
+    for (const auto* continueStmt : continues) {
+        s.getRewriter().ReplaceText(SourceRange{continueStmt->getContinueLoc()}, "return");
+    }
+}
+}  // namespace oklt::threads
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "attributes/attribute_names.h"
+#include "attributes/frontend/params/loop.h"
+#include "attributes/frontend/params/tile.h"
+#include "attributes/utils/serial_subset/handle.h"
+#include "core/handler_manager/backend_handler.h"
+#include "core/sema/okl_sema_ctx.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/attributes.h"
+
+#include <string>
+
+namespace oklt::threads {
+// Closes the lambda and the call after the outlined loop body
+const std::string parallelForSuffix = ");";
+
+/**
+ * @brief Builds `okl_threads::parallel_for<T>(start, end, step, [&](T var)` call header. Inclusive
+ * bounds are converted to half-open ones, decreasing loops use `parallel_for_reverse`.
+ */
+std::string buildParallelForHeader(const OklLoopInfo& loopInfo,
+                                   const std::string& var,
+                                   const std::string& start,
+                                   const std::string& end,
+                                   const std::string& step);
+
+/**
+ * @brief Outlines the body of the top-level @outer loop into a lambda and dispatches its
+ * iterations to the thread pool of the runtime.
+ */
+HandleResult outlineOuterLoop(SessionStage& s,
+                              const clang::ForStmt& stmt,
+                              const OklLoopInfo& loopInfo);
+
+/**
+ * @brief Rejects `return` and `break` of the outlined loop body, that can't leave the loop from
+ * the lambda.
+ */
+HandleResult checkOutlinedBody(const clang::Stmt& body, const std::string& attrName);
+
+/**
+ * @brief `continue` of the outlined body becomes `return` from the lambda.
+ */
+void replaceOutlinedContinues(SessionStage& s, const clang::Stmt& body);
+}  // namespace oklt::threads
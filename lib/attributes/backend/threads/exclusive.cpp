@@ -0,0 +1,19 @@
+#include "attributes/backend/threads/common.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+__attribute__((constructor)) void registerTHREADSExclusiveHandler() {
+    auto ok = registerBackendHandler(
+        TargetBackend::THREADS, EXCLUSIVE_ATTR_NAME, serial_subset::handleExclusiveExprAttribute);
+    ok &= registerBackendHandler(
+        TargetBackend::THREADS, EXCLUSIVE_ATTR_NAME, serial_subset::handleExclusiveDeclAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("[THREADS] Failed to register {} attribute handler", EXCLUSIVE_ATTR_NAME);
+    }
+}
+}  // namespace
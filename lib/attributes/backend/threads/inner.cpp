@@ -0,0 +1,17 @@
+#include "attributes/backend/threads/common.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+__attribute__((constructor)) void registerTHREADSInnerHandler() {
+    auto ok = registerBackendHandler(
+        TargetBackend::THREADS, INNER_ATTR_NAME, serial_subset::handleInnerAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("[THREADS] Failed to register {} attribute handler", INNER_ATTR_NAME);
+    }
+}
+}  // namespace
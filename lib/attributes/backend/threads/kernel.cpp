@@ -0,0 +1,17 @@
+#include "attributes/backend/threads/common.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+__attribute__((constructor)) void registerTHREADSKernelHandler() {
+    auto ok = registerBackendHandler(
+        TargetBackend::THREADS, KERNEL_ATTR_NAME, serial_subset::handleKernelAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("[THREADS] Failed to register {} attribute handler", KERNEL_ATTR_NAME);
+    }
+}
+}  // namespace
@@ -0,0 +1,39 @@
+#include "attributes/backend/threads/common.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+HandleResult handleTHREADSOuterAttribute(SessionStage& s,
+                                         const ForStmt& stmt,
+                                         const Attr& a,
+                                         const AttributedLoop* params) {
+    auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
+    auto loopInfo = sema.getLoopInfo(stmt);
+    if (!loopInfo) {
+        return tl::make_unexpected(Error{{}, "@outer: failed to fetch loop meta data from sema"});
+    }
+
+    // Top level `@outer` loop, nested ones run serially inside of the outlined body
+    auto parent = loopInfo->getAttributedParent();
+    if (!parent && loopInfo->has(LoopType::Outer)) {
+        auto ok = threads::outlineOuterLoop(s, stmt, *loopInfo);
+        if (!ok) {
+            return ok;
+        }
+    }
+
+    return serial_subset::handleOuterAttribute(s, stmt, a, params);
+}
+
+__attribute__((constructor)) void registerTHREADSOuterHandler() {
+    auto ok = registerBackendHandler(
+        TargetBackend::THREADS, OUTER_ATTR_NAME, handleTHREADSOuterAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("[THREADS] Failed to register {} attribute handler", OUTER_ATTR_NAME);
+    }
+}
+}  // namespace
@@ -0,0 +1,17 @@
+#include "attributes/backend/threads/common.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+__attribute__((constructor)) void registerTHREADSRestrictHandler() {
+    auto ok = registerBackendHandler(
+        TargetBackend::THREADS, RESTRICT_ATTR_NAME, serial_subset::handleRestrictAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("[THREADS] Failed to register {} attribute handler", RESTRICT_ATTR_NAME);
+    }
+}
+}  // namespace
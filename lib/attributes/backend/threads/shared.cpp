@@ -0,0 +1,22 @@
+#include "attributes/backend/threads/common.h"
+#include "attributes/utils/default_handlers.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+__attribute__((constructor)) void registerTHREADSSharedHandler() {
+    auto ok = registerBackendHandler(
+        TargetBackend::THREADS, SHARED_ATTR_NAME, serial_subset::handleSharedAttribute);
+
+    // Empty Stmt handler since @shared variable is of attributed type, it is called on DeclRefExpr
+    ok &= registerBackendHandler(
+        TargetBackend::THREADS, SHARED_ATTR_NAME, defaultHandleSharedStmtAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("[THREADS] Failed to register {} attribute handler", SHARED_ATTR_NAME);
+    }
+}
+}  // namespace
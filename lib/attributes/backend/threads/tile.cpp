@@ -0,0 +1,71 @@
+#include "attributes/backend/threads/common.h"
+
+#include <spdlog/spdlog.h>
+
+namespace {
+using namespace oklt;
+using namespace clang;
+
+HandleResult handleTHREADSTileAttribute(SessionStage& s,
+                                        const ForStmt& stmt,
+                                        const Attr& a,
+                                        const TileParams* params) {
+    if (!params) {
+        return tl::make_unexpected(Error{std::error_code(), "@tile params nullptr"});
+    }
+
+    auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
+    auto loopInfo = sema.getLoopInfo(stmt);
+    if (!loopInfo) {
+        return tl::make_unexpected(Error{{}, "@tile: failed to fetch loop meta data from sema"});
+    }
+
+    // Only top level `@tile(@outer, ...)` loop over tiles is outlined
+    auto parent = loopInfo->getAttributedParent();
+    if (parent || loopInfo->type[0] != LoopType::Outer) {
+        return serial_subset::handleTileAttribute(s, stmt, a, params);
+    }
+
+    if (!isa_and_nonnull<CompoundStmt>(stmt.getBody())) {
+        return tl::make_unexpected(
+            Error{{}, "[@tile] body of the top-level loop must be a compound statement"});
+    }
+    auto checked = threads::checkOutlinedBody(*stmt.getBody(), "[@tile]");
+    if (!checked) {
+        return checked;
+    }
+
+    // Peeled remainder would be placed before the call, out of the thread pool
+    TileParams outlinedParams = *params;
+    outlinedParams.peel = false;
+
+    auto ok = serial_subset::handleTileAttribute(
+        s,
+        stmt,
+        a,
+        &outlinedParams,
+        "",
+        [](const OklLoopInfo& loop,
+           const std::string& tiledVar,
+           const std::string& start,
+           const std::string& end,
+           const std::string& step) {
+            return threads::buildParallelForHeader(loop, tiledVar, start, end, step);
+        });
+    if (!ok) {
+        return ok;
+    }
+
+    s.getRewriter().InsertTextAfterToken(stmt.getEndLoc(), threads::parallelForSuffix);
+    return {};
+}
+
+__attribute__((constructor)) void registerTHREADSTileHandler() {
+    auto ok =
+        registerBackendHandler(TargetBackend::THREADS, TILE_ATTR_NAME, handleTHREADSTileAttribute);
+
+    if (!ok) {
+        SPDLOG_ERROR("[THREADS] Failed to register {} attribute handler", TILE_ATTR_NAME);
+    }
+}
+}  // namespace
@@ -0,0 +1,57 @@
+#include "attributes/attribute_names.h"
+#include "attributes/frontend/params/empty_params.h"
+#include "attributes/utils/parser.h"
+
+#include "core/handler_manager/parse_handler.h"
+#include "core/transpiler_session/session_stage.h"
+
+#include <clang/Basic/DiagnosticSema.h>
+#include <clang/Sema/ParsedAttr.h>
+#include <clang/Sema/Sema.h>
+
+namespace {
+
+using namespace clang;
+using namespace oklt;
+
+constexpr ParsedAttrInfo::Spelling NO_RESTRICT_ATTRIBUTE_SPELLINGS[] = {
+    {ParsedAttr::AS_CXX11, NO_RESTRICT_ATTR_NAME},
+    {ParsedAttr::AS_GNU, NO_RESTRICT_ATTR_NAME}};
+
+struct NoRestrictAttribute : public ParsedAttrInfo {
+    NoRestrictAttribute() {
+        NumArgs = 1;
+        OptArgs = 0;
+        Spellings = NO_RESTRICT_ATTRIBUTE_SPELLINGS;
+        AttrKind = clang::AttributeCommonInfo::AT_Annotate;
+    }
+
+    bool diagAppertainsToDecl(clang::Sema& sema,
+                              const clang::ParsedAttr& attr,
+                              const clang::Decl* decl) const override {
+        // INFO: opts out kernel parameter from read-only inference
+        const auto* param = dyn_cast<ParmVarDecl>(decl);
+        if (!param || !param->getType()->isPointerType()) {
+            sema.Diag(attr.getLoc(), diag::err_attribute_wrong_decl_type_str)
+                << attr << ":"
+                << "parameters of pointer type in function";
+            return false;
+        }
+        return true;
+    }
+};
+
+HandleResult parseNoRestrictAttrParams(SessionStage& stage,
+                                       const clang::Attr& attr,
+                                       OKLParsedAttr& data) {
+    if (!data.args.empty() || !data.kwargs.empty()) {
+        return tl::make_unexpected(Error{{}, "[@norestrict] does not take arguments"});
+    }
+
+    return EmptyParams{};
+}
+
+__attribute__((constructor)) void registerNoRestrictAttrFrontend() {
+    registerAttrFrontend<NoRestrictAttribute>(NO_RESTRICT_ATTR_NAME, parseNoRestrictAttrParams);
+}
+}  // namespace
@@ -29,4 +29,21 @@ struct AttributedLoopSimdLength {
     int size = -1;
 };
 
+struct AttributedLoopMinBlocks {
+    int size = -1;
+};
+
+struct AttributedLoopPipeline {
+    int stages = -1;
+};
+
+struct AttributedLoopUnroll {
+    int factor = 0;  ///< 0 requests full unrolling.
+    bool expand = false;
+};
+
+struct AttributedLoopSchedule {
+    ScheduleInfo policy;
+};
+
 }  // namespace oklt
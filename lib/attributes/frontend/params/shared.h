@@ -0,0 +1,11 @@
+#pragma once
+
+#include <optional>
+
+namespace oklt {
+
+struct AttributedShared {
+    std::optional<bool> pad;  ///< Bank padding forced by `pad` or disabled by `nopad`.
+};
+
+}  // namespace oklt
@@ -1,6 +1,7 @@
 #pragma once
 #include "attributes/frontend/params/loop.h"
 
+#include <optional>
 #include <string>
 
 namespace oklt {
@@ -14,5 +15,6 @@ struct TileParams {
     AttributedLoop firstLoop = AttributedLoop{};
     AttributedLoop secondLoop = AttributedLoop{};
     bool check = true;
+    std::optional<bool> peel = std::nullopt;  ///< Peel remainder tile on host, user default if unset
 };
 }  // namespace oklt
@@ -0,0 +1,79 @@
+#include "attributes/attribute_names.h"
+#include "attributes/frontend/params/loop.h"
+#include "attributes/utils/parser.h"
+#include "attributes/utils/parser_impl.hpp"
+
+#include "core/handler_manager/parse_handler.h"
+
+#include <clang/Basic/DiagnosticSema.h>
+#include <clang/Sema/ParsedAttr.h>
+#include <clang/Sema/Sema.h>
+
+namespace {
+using namespace clang;
+using namespace oklt;
+
+constexpr ParsedAttrInfo::Spelling PIPELINE_ATTRIBUTE_SPELLINGS[] = {
+    {ParsedAttr::AS_CXX11, PIPELINE_ATTR_NAME},
+    {ParsedAttr::AS_GNU, PIPELINE_ATTR_NAME}};
+
+struct PipelineAttribute : public ParsedAttrInfo {
+    PipelineAttribute() {
+        NumArgs = 1;
+        OptArgs = 0;
+        Spellings = PIPELINE_ATTRIBUTE_SPELLINGS;
+        AttrKind = clang::AttributeCommonInfo::AT_Suppress;
+        IsStmt = true;
+    }
+
+    bool diagAppertainsToStmt(clang::Sema& sema,
+                              const clang::ParsedAttr& attr,
+                              const clang::Stmt* stmt) const override {
+        if (!isa<ForStmt>(stmt)) {
+            sema.Diag(attr.getLoc(), diag::err_attribute_wrong_decl_type_str)
+                << attr << attr.isDeclspecAttribute() << "for statement";
+            return false;
+        }
+        return true;
+    }
+
+    bool diagAppertainsToDecl(clang::Sema& sema,
+                              const clang::ParsedAttr& attr,
+                              const clang::Decl* decl) const override {
+        // INFO: fail for all decls
+        sema.Diag(attr.getLoc(), diag::err_attribute_wrong_decl_type_str)
+            << attr << attr.isDeclspecAttribute() << "for statement";
+        return false;
+    }
+};
+
+HandleResult parsePipelineAttrParams(SessionStage& stage,
+                                    const clang::Attr& attr,
+                                    OKLParsedAttr& data) {
+    if (!data.kwargs.empty()) {
+        return tl::make_unexpected(Error{{}, "[@pipeline] does not take kwargs"});
+    }
+
+    // Double buffering by default
+    if (data.args.empty()) {
+        return AttributedLoopPipeline{.stages = 2};
+    }
+
+    if (data.args.size() != 1) {
+        return tl::make_unexpected(Error{{}, "[@pipeline] takes at most one argument"});
+    }
+
+    auto stages = data.get<int>(0);
+    if (!stages) {
+        return tl::make_unexpected(Error{{}, "[@pipeline] takes an integer argument"});
+    } else if (stages.value() < 2) {
+        return tl::make_unexpected(Error{{}, "[@pipeline] number of stages must be at least 2"});
+    }
+
+    return AttributedLoopPipeline{.stages = stages.value()};
+}
+
+__attribute__((constructor)) void registerPipelineAttrFrontend() {
+    registerAttrFrontend<PipelineAttribute>(PIPELINE_ATTR_NAME, parsePipelineAttrParams);
+}
+}  // namespace
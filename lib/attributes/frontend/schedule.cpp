@@ -0,0 +1,142 @@
+#include "attributes/attribute_names.h"
+#include "attributes/frontend/params/loop.h"
+#include "attributes/utils/parser.h"
+#include "attributes/utils/parser_impl.hpp"
+
+#include "core/handler_manager/parse_handler.h"
+
+#include <clang/Basic/DiagnosticSema.h>
+#include <clang/Sema/ParsedAttr.h>
+#include <clang/Sema/Sema.h>
+
+namespace {
+using namespace clang;
+using namespace oklt;
+
+constexpr ParsedAttrInfo::Spelling SCHEDULE_ATTRIBUTE_SPELLINGS[] = {
+    {ParsedAttr::AS_CXX11, SCHEDULE_ATTR_NAME},
+    {ParsedAttr::AS_GNU, SCHEDULE_ATTR_NAME}};
+
+struct ScheduleAttribute : public ParsedAttrInfo {
+    ScheduleAttribute() {
+        NumArgs = 1;
+        OptArgs = 0;
+        Spellings = SCHEDULE_ATTRIBUTE_SPELLINGS;
+        AttrKind = clang::AttributeCommonInfo::AT_Suppress;
+        IsStmt = true;
+    }
+
+    bool diagAppertainsToStmt(clang::Sema& sema,
+                              const clang::ParsedAttr& attr,
+                              const clang::Stmt* stmt) const override {
+        if (!isa<ForStmt>(stmt)) {
+            sema.Diag(attr.getLoc(), diag::err_attribute_wrong_decl_type_str)
+                << attr << attr.isDeclspecAttribute() << "for statement";
+            return false;
+        }
+        return true;
+    }
+
+    bool diagAppertainsToDecl(clang::Sema& sema,
+                              const clang::ParsedAttr& attr,
+                              const clang::Decl* decl) const override {
+        // INFO: fail for all decls
+        sema.Diag(attr.getLoc(), diag::err_attribute_wrong_decl_type_str)
+            << attr << attr.isDeclspecAttribute() << "for statement";
+        return false;
+    }
+};
+
+// INFO: accept both @schedule("dynamic") and @schedule(dynamic)
+std::string getNameParam(const OKLAttrParam& param) {
+    if (param.isa<std::string>()) {
+        return param.get<std::string>().value();
+    }
+    return std::string(param.getRaw());
+}
+
+tl::expected<int, Error> getPositiveParam(const OKLAttrParam& param, const std::string& name) {
+    auto val = param.get<int>();
+    if (!val) {
+        return tl::make_unexpected(
+            Error{{}, "[@schedule] '" + name + "' argument must be an integer"});
+    }
+    if (val.value() <= 0) {
+        return tl::make_unexpected(
+            Error{{}, "[@schedule] '" + name + "' argument must be positive!"});
+    }
+    return val.value();
+}
+
+HandleResult parseScheduleAttrParams(SessionStage& stage,
+                                     const clang::Attr& attr,
+                                     OKLParsedAttr& data) {
+    if (data.args.size() > 2) {
+        return tl::make_unexpected(
+            Error{{}, "[@schedule] takes at most 2 arguments: schedule kind and chunk size"});
+    }
+
+    ScheduleInfo ret;
+    if (!data.args.empty()) {
+        auto kind = scheduleKindFromString(getNameParam(data.args[0]));
+        if (!kind) {
+            return tl::make_unexpected(Error{
+                {}, "[@schedule] kind must be one of: static, dynamic, guided, auto, runtime"});
+        }
+        ret.kind = kind.value();
+    }
+
+    if (data.args.size() == 2) {
+        auto chunk = getPositiveParam(data.args[1], "chunk");
+        if (!chunk) {
+            return tl::make_unexpected(std::move(chunk.error()));
+        }
+        ret.chunk = chunk.value();
+    }
+
+    for (const auto& param : data.kwargs) {
+        if (param.first == "chunk") {
+            auto chunk = getPositiveParam(param.second, param.first);
+            if (!chunk) {
+                return tl::make_unexpected(std::move(chunk.error()));
+            }
+            ret.chunk = chunk.value();
+            continue;
+        }
+
+        if (param.first == "num_threads") {
+            auto numThreads = getPositiveParam(param.second, param.first);
+            if (!numThreads) {
+                return tl::make_unexpected(std::move(numThreads.error()));
+            }
+            ret.numThreads = numThreads.value();
+            continue;
+        }
+
+        if (param.first == "proc_bind") {
+            auto procBind = procBindFromString(getNameParam(param.second));
+            if (!procBind) {
+                return tl::make_unexpected(
+                    Error{{}, "[@schedule] 'proc_bind' must be one of: primary, close, spread"});
+            }
+            ret.procBind = procBind.value();
+            continue;
+        }
+
+        return tl::make_unexpected(Error{{}, "[@schedule] does not take this kwarg"});
+    }
+
+    if (ret.chunk > 0 &&
+        (ret.kind == ScheduleKind::Default || ret.kind == ScheduleKind::Auto ||
+         ret.kind == ScheduleKind::Runtime)) {
+        return tl::make_unexpected(
+            Error{{}, "[@schedule] chunk size requires static, dynamic or guided kind"});
+    }
+
+    return AttributedLoopSchedule{.policy = ret};
+}
+
+__attribute__((constructor)) void registerScheduleAttrFrontend() {
+    registerAttrFrontend<ScheduleAttribute>(SCHEDULE_ATTR_NAME, parseScheduleAttrParams);
+}
+}  // namespace
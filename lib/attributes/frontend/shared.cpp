@@ -4,7 +4,7 @@
 #include "core/transpiler_session/session_stage.h"
 
 #include "attributes/utils/parser.h"
-#include "params/empty_params.h"
+#include "params/shared.h"
 
 #include <clang/Basic/DiagnosticSema.h>
 #include <clang/Sema/ParsedAttr.h>
@@ -112,14 +112,35 @@ struct SharedAttribute : public ParsedAttrInfo {
     }
 };
 
+// INFO: accept both @shared("pad") and @shared(pad)
+std::string getModeParam(const OKLAttrParam& param) {
+    if (param.isa<std::string>()) {
+        return param.get<std::string>().value();
+    }
+    return std::string(param.getRaw());
+}
+
 HandleResult parseSharedAttrParams(SessionStage& stage,
                                    const clang::Attr& attr,
-                                  OKLParsedAttr& data) {
-    if (!data.args.empty() || !data.kwargs.empty()) {
-        return tl::make_unexpected(Error{{}, "[@shared] does not take arguments"});
+                                   OKLParsedAttr& data) {
+    if (!data.kwargs.empty()) {
+        return tl::make_unexpected(Error{{}, "[@shared] does not take kwargs"});
+    }
+
+    if (data.args.empty()) {
+        return AttributedShared{};
+    }
+
+    if (data.args.size() != 1) {
+        return tl::make_unexpected(Error{{}, "[@shared] takes at most one argument"});
+    }
+
+    auto mode = getModeParam(data.args[0]);
+    if (mode != "pad" && mode != "nopad") {
+        return tl::make_unexpected(Error{{}, "[@shared] argument must be 'pad' or 'nopad'"});
     }
 
-    return EmptyParams{};
+    return AttributedShared{.pad = mode == "pad"};
 }
 
 __attribute__((constructor)) void registerSharedAttrFrontend() {
@@ -92,14 +92,20 @@ HandleResult parseTileAttribute(SessionStage& stage, const clang::Attr& attr, OK
     }
 
     for (const auto& param : data.kwargs) {
-        if (param.first != "check") {
+        if (param.first != "check" && param.first != "peel") {
             return tl::make_unexpected(Error{{}, "[@tile] does not take this kwarg"});
         }
 
         if (!param.second.isa<bool>()) {
-            return tl::make_unexpected(Error{{}, "[@tile] 'check' argument must be true or false"});
+            return tl::make_unexpected(
+                Error{{}, "[@tile] '" + param.first + "' argument must be true or false"});
+        }
+
+        if (param.first == "check") {
+            param.second.getTo(ret.check);
+        } else {
+            ret.peel = param.second.get<bool>();
         }
-        param.second.getTo(ret.check);
     }
 
     return ret;
@@ -0,0 +1,92 @@
+#include "attributes/attribute_names.h"
+#include "attributes/frontend/params/loop.h"
+#include "attributes/utils/parser.h"
+#include "attributes/utils/parser_impl.hpp"
+
+#include "core/handler_manager/parse_handler.h"
+
+#include <clang/Basic/DiagnosticSema.h>
+#include <clang/Sema/ParsedAttr.h>
+#include <clang/Sema/Sema.h>
+
+namespace {
+using namespace clang;
+using namespace oklt;
+
+constexpr ParsedAttrInfo::Spelling UNROLL_ATTRIBUTE_SPELLINGS[] = {
+    {ParsedAttr::AS_CXX11, UNROLL_ATTR_NAME},
+    {ParsedAttr::AS_GNU, UNROLL_ATTR_NAME}};
+
+struct UnrollAttribute : public ParsedAttrInfo {
+    UnrollAttribute() {
+        NumArgs = 1;
+        OptArgs = 0;
+        Spellings = UNROLL_ATTRIBUTE_SPELLINGS;
+        AttrKind = clang::AttributeCommonInfo::AT_Suppress;
+        IsStmt = true;
+    }
+
+    bool diagAppertainsToStmt(clang::Sema& sema,
+                              const clang::ParsedAttr& attr,
+                              const clang::Stmt* stmt) const override {
+        if (!isa<ForStmt>(stmt)) {
+            sema.Diag(attr.getLoc(), diag::err_attribute_wrong_decl_type_str)
+                << attr << attr.isDeclspecAttribute() << "for statement";
+            return false;
+        }
+        return true;
+    }
+
+    bool diagAppertainsToDecl(clang::Sema& sema,
+                              const clang::ParsedAttr& attr,
+                              const clang::Decl* decl) const override {
+        // INFO: fail for all decls
+        sema.Diag(attr.getLoc(), diag::err_attribute_wrong_decl_type_str)
+            << attr << attr.isDeclspecAttribute() << "for statement";
+        return false;
+    }
+};
+
+// INFO: accept both @unroll("expand") and @unroll(expand)
+std::string getNameParam(const OKLAttrParam& param) {
+    if (param.isa<std::string>()) {
+        return param.get<std::string>().value();
+    }
+    return std::string(param.getRaw());
+}
+
+HandleResult parseUnrollAttrParams(SessionStage& stage,
+                                   const clang::Attr& attr,
+                                   OKLParsedAttr& data) {
+    if (!data.kwargs.empty()) {
+        return tl::make_unexpected(Error{{}, "[@unroll] does not take kwargs"});
+    }
+
+    // Full unrolling
+    if (data.args.empty()) {
+        return AttributedLoopUnroll{};
+    }
+
+    if (data.args.size() != 1) {
+        return tl::make_unexpected(Error{{}, "[@unroll] takes at most one argument"});
+    }
+
+    if (getNameParam(data.args[0]) == "expand") {
+        return AttributedLoopUnroll{.expand = true};
+    }
+
+    auto factor = data.get<int>(0);
+    if (!factor) {
+        return tl::make_unexpected(
+            Error{{}, "[@unroll] takes an integer unroll factor or 'expand' argument"});
+    } else if (factor.value() <= 0) {
+        return tl::make_unexpected(Error{{}, "[@unroll] unroll factor must be positive!"});
+    }
+
+    return AttributedLoopUnroll{.factor = factor.value()};
+}
+
+__attribute__((constructor)) void registerUnrollAttrFrontend() {
+    registerAttrFrontend<UnrollAttribute>(UNROLL_ATTR_NAME, parseUnrollAttrParams);
+}
+}  // namespace
@@ -0,0 +1,178 @@
+#include "attributes/attribute_names.h"
+#include "attributes/utils/async_copy_pipeline.h"
+#include "core/transpiler_session/attributed_type_map.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
+
+#include <clang/AST/AST.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+
+#include <algorithm>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+const std::string NOT_APPLIED = "[@pipeline] is ignored, copies stay synchronous: ";
+
+const Expr* stripSubscripts(const Expr& expr) {
+    const auto* current = expr.IgnoreParenImpCasts();
+    while (const auto* subscript = dyn_cast<ArraySubscriptExpr>(current)) {
+        current = subscript->getBase()->IgnoreParenImpCasts();
+    }
+    return current;
+}
+
+// @shared array of known size, which element is assigned
+const VarDecl* getTile(SessionStage& s, const Expr& target) {
+    const auto* ref = dyn_cast<DeclRefExpr>(stripSubscripts(target));
+    const auto* var = ref ? dyn_cast<VarDecl>(ref->getDecl()) : nullptr;
+    if (!var) {
+        return nullptr;
+    }
+
+    auto& ctx = s.getCompiler().getASTContext();
+    auto& attrTypeMap = s.tryEmplaceUserCtx<AttributedTypeMap>();
+    if (!attrTypeMap.has(ctx, var->getType(), {SHARED_ATTR_NAME}) ||
+        !ctx.getAsConstantArrayType(var->getType())) {
+        return nullptr;
+    }
+    return var;
+}
+
+// Element of the kernel argument array, that resides in global memory
+bool isArgumentElement(const Expr& source) {
+    if (!isa<ArraySubscriptExpr>(source.IgnoreParenImpCasts())) {
+        return false;
+    }
+    const auto* ref = dyn_cast<DeclRefExpr>(stripSubscripts(source));
+    const auto* param = ref ? dyn_cast<ParmVarDecl>(ref->getDecl()) : nullptr;
+    return param && param->getType()->isPointerType();
+}
+
+// Asynchronous copy is done by chunks of 4, 8 or 16 bytes aligned to their size
+bool isAsyncCopyable(ASTContext& ctx, QualType type) {
+    if (type->isDependentType() || type->isIncompleteType() || type->isArrayType() ||
+        !type.isTriviallyCopyableType(ctx)) {
+        return false;
+    }
+    auto size = ctx.getTypeSizeInChars(type).getQuantity();
+    return (size == 4 || size == 8 || size == 16) &&
+           ctx.getTypeAlignInChars(type).getQuantity() == size;
+}
+
+// Collects references to the tiles and statements, that leave the iteration early
+class TileRefCollector : public RecursiveASTVisitor<TileRefCollector> {
+   public:
+    explicit TileRefCollector(const std::vector<const VarDecl*>& tiles)
+        : _tiles(tiles) {}
+
+    bool VisitDeclRefExpr(DeclRefExpr* expr) {
+        if (std::find(_tiles.begin(), _tiles.end(), expr->getDecl()) != _tiles.end()) {
+            refs.push_back(expr);
+        }
+        return true;
+    }
+
+    bool VisitReturnStmt(ReturnStmt*) { return exitFound(); }
+    bool VisitBreakStmt(BreakStmt*) { return exitFound(); }
+    bool VisitContinueStmt(ContinueStmt*) { return exitFound(); }
+    bool VisitGotoStmt(GotoStmt*) { return exitFound(); }
+
+    void collect(const Stmt& stmt) { TraverseStmt(const_cast<Stmt*>(&stmt)); }
+
+    std::vector<const DeclRefExpr*> refs;
+    bool hasEarlyExit = false;
+
+   private:
+    bool exitFound() {
+        hasEarlyExit = true;
+        return true;
+    }
+
+    const std::vector<const VarDecl*>& _tiles;
+};
+
+const Stmt* stripAttributes(const Stmt* stmt) {
+    if (const auto* attributed = dyn_cast_or_null<AttributedStmt>(stmt)) {
+        return attributed->getSubStmt();
+    }
+    return stmt;
+}
+}  // namespace
+
+std::optional<AsyncCopyPipeline> matchAsyncCopyPipeline(SessionStage& s, OklLoopInfo& copy) {
+    if (!copy.pipelineStages) {
+        return std::nullopt;
+    }
+    auto ignore = [&s](const std::string& reason) -> std::optional<AsyncCopyPipeline> {
+        s.pushWarning(NOT_APPLIED + reason);
+        return std::nullopt;
+    };
+
+    if (s.getSession().getInput().dynamicShared) {
+        return ignore("not supported with dynamic shared memory");
+    }
+
+    auto* loop = copy.parent;
+    auto* outer = loop ? loop->parent : nullptr;
+    if (!copy.is(LoopType::Inner) || !loop || !loop->isRegular() || !outer ||
+        !outer->has(LoopType::Outer) || outer->has(LoopType::Inner)) {
+        return ignore("[@inner] loop must be placed into a sequential loop inside [@outer] loop");
+    }
+
+    const auto* body = dyn_cast_or_null<CompoundStmt>(loop->stmt.getBody());
+    if (!body || body->size() < 2 || stripAttributes(body->body_front()) != &copy.stmt) {
+        return ignore("[@inner] loop must start the sequential loop and be followed by compute");
+    }
+
+    if (!loop->var.varDecl || !loop->range.start || !loop->range.end ||
+        loop->condition.op != BinOp::Lt || !loop->isUnary() || !loop->IsInc()) {
+        return ignore("sequential loop must have '<' condition and unit increment");
+    }
+
+    const auto* copyBody = dyn_cast_or_null<CompoundStmt>(copy.stmt.getBody());
+    if (!copyBody || copyBody->body_empty()) {
+        return ignore("[@inner] loop must have a compound body");
+    }
+
+    auto& ctx = s.getCompiler().getASTContext();
+    AsyncCopyPipeline pipeline{.loop = loop, .copy = &copy, .stages = *copy.pipelineStages};
+    for (const auto* stmt : copyBody->body()) {
+        const auto* assign = dyn_cast<BinaryOperator>(stmt);
+        const auto* tile =
+            assign && assign->getOpcode() == BO_Assign ? getTile(s, *assign->getLHS()) : nullptr;
+        if (!tile || !isArgumentElement(*assign->getRHS()) ||
+            !ctx.hasSameUnqualifiedType(assign->getLHS()->getType(),
+                                        assign->getRHS()->IgnoreParenImpCasts()->getType())) {
+            return ignore(
+                "[@inner] loop must only assign elements of kernel arguments to [@shared] arrays");
+        }
+        if (!isAsyncCopyable(ctx, assign->getLHS()->getType())) {
+            return ignore("copied elements must be of 4, 8 or 16 bytes");
+        }
+
+        pipeline.copies.push_back(assign);
+        if (std::find(pipeline.tiles.begin(), pipeline.tiles.end(), tile) ==
+            pipeline.tiles.end()) {
+            pipeline.tiles.push_back(tile);
+        }
+    }
+
+    // Buffer of the tile is selected by the iteration, so it can't be used outside of it
+    TileRefCollector loopRefs(pipeline.tiles);
+    loopRefs.collect(*body);
+    TileRefCollector outerRefs(pipeline.tiles);
+    outerRefs.collect(*outer->stmt.getBody());
+    if (loopRefs.hasEarlyExit) {
+        return ignore("sequential loop must not be left early");
+    }
+    if (loopRefs.refs.size() != outerRefs.refs.size()) {
+        return ignore("[@shared] arrays must be used only inside the sequential loop");
+    }
+
+    pipeline.tileRefs = std::move(loopRefs.refs);
+    return pipeline;
+}
+
+}  // namespace oklt
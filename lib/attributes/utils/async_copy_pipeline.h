@@ -0,0 +1,45 @@
+#pragma once
+
+#include "core/sema/okl_sema_info.h"
+
+#include <optional>
+#include <vector>
+
+namespace clang {
+class BinaryOperator;
+class DeclRefExpr;
+class VarDecl;
+}  // namespace clang
+
+namespace oklt {
+
+class SessionStage;
+
+/**
+ * @struct AsyncCopyPipeline
+ * @brief This structure represents a sequential loop inside @outer loop, that starts with @inner
+ * loop under @pipeline attribute copying elements of kernel arguments into @shared arrays. Copies
+ * of the next iterations can be issued asynchronously, while the current iteration is computed.
+ */
+struct AsyncCopyPipeline {
+    OklLoopInfo* loop;                                 ///< Sequential loop.
+    OklLoopInfo* copy;                                 ///< @inner loop, that copies the tiles.
+    int stages;                                        ///< Number of buffers of each tile.
+    std::vector<const clang::BinaryOperator*> copies;  ///< `tile[...] = arg[...]` assignments.
+    std::vector<const clang::VarDecl*> tiles;          ///< Copied @shared arrays.
+    std::vector<const clang::DeclRefExpr*> tileRefs;   ///< References to tiles in sequential loop.
+};
+
+/**
+ * @brief Checks if @inner loop under @pipeline attribute can be pipelined: it is the first
+ * statement of a sequential loop with `<` condition and unit increment placed directly into @outer
+ * loop, its body consists only of assignments of elements of kernel arguments to elements of
+ * @shared arrays of 4, 8 or 16 bytes, these arrays are used only inside the sequential loop and
+ * the sequential loop isn't left early. Pushes a warning, if @pipeline can't be applied.
+ * @param s The session stage.
+ * @param copy The @inner loop.
+ * @return Matched pipeline or nullopt.
+ */
+std::optional<AsyncCopyPipeline> matchAsyncCopyPipeline(SessionStage& s, OklLoopInfo& copy);
+
+}  // namespace oklt
@@ -0,0 +1,241 @@
+#include "attributes/attribute_names.h"
+#include "attributes/utils/atomic_reduction.h"
+#include "core/sema/okl_sema_ctx.h"
+#include "core/transpiler_session/attributed_type_map.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/attributes.h"
+
+#include <clang/AST/AST.h>
+#include <clang/AST/ParentMapContext.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+#include <clang/Lex/Lexer.h>
+
+#include <map>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+const std::map<BinaryOperatorKind, std::string> COMBINE_OPS = {
+    {BO_AddAssign, "+"},
+    {BO_SubAssign, "+"},
+    {BO_AndAssign, "&"},
+    {BO_OrAssign, "|"},
+    {BO_XorAssign, "^"},
+};
+
+// Outermost @inner loop of the chain of @inner loops, that is placed directly into @outer loop
+OklLoopInfo* getTopInnerLoop(OklLoopInfo& loop) {
+    if (!loop.is(LoopType::Inner)) {
+        return nullptr;
+    }
+    auto* top = &loop;
+    while (top->parent && top->parent->is(LoopType::Inner)) {
+        top = top->parent;
+    }
+    auto* outer = top->parent;
+    if (!outer || !outer->has(LoopType::Outer) || outer->has(LoopType::Inner)) {
+        return nullptr;
+    }
+    return top;
+}
+
+bool isInLoopBody(ASTContext& ctx, const Stmt& stmt, const OklLoopInfo& loop) {
+    auto parents = ctx.getParents(stmt);
+    if (parents.size() != 1 || !parents[0].get<AttributedStmt>()) {
+        return false;
+    }
+    const auto* attributed = parents[0].get<AttributedStmt>();
+    if (attributed == loop.stmt.getBody()) {
+        return true;
+    }
+
+    parents = ctx.getParents(*attributed);
+    return parents.size() == 1 && parents[0].get<Stmt>() == loop.stmt.getBody();
+}
+
+// Threads leaving the loop early don't take part in the reduction
+class EarlyExitFinder : public RecursiveASTVisitor<EarlyExitFinder> {
+   public:
+    bool VisitReturnStmt(ReturnStmt*) { return found(); }
+    bool VisitBreakStmt(BreakStmt*) { return found(); }
+    bool VisitContinueStmt(ContinueStmt*) { return found(); }
+    bool VisitGotoStmt(GotoStmt*) { return found(); }
+
+    bool hasEarlyExit(const Stmt& body) {
+        TraverseStmt(const_cast<Stmt*>(&body));
+        return _found;
+    }
+
+   private:
+    bool found() {
+        _found = true;
+        return false;
+    }
+
+    bool _found = false;
+};
+
+// Any direct write of the variable inside the loop may give it a value per thread
+class VarWriteFinder : public RecursiveASTVisitor<VarWriteFinder> {
+   public:
+    explicit VarWriteFinder(const VarDecl& var)
+        : _var(var) {}
+
+    bool VisitBinaryOperator(BinaryOperator* op) {
+        return !op->isAssignmentOp() || !check(op->getLHS());
+    }
+
+    bool VisitUnaryOperator(UnaryOperator* op) {
+        if (op->isIncrementDecrementOp() || op->getOpcode() == UO_AddrOf) {
+            return !check(op->getSubExpr());
+        }
+        return true;
+    }
+
+    bool isWrittenIn(const Stmt& stmt) {
+        TraverseStmt(const_cast<Stmt*>(&stmt));
+        return _found;
+    }
+
+   private:
+    bool check(const Expr* expr) {
+        const auto* ref = dyn_cast<DeclRefExpr>(expr->IgnoreParenImpCasts());
+        _found = ref && ref->getDecl() == &_var;
+        return _found;
+    }
+
+    const VarDecl& _var;
+    bool _found = false;
+};
+
+// Expression is uniform over the threads of the block if it refers only to kernel parameters,
+// iteration variables of @outer loops, that aren't written by the threads, and const variables
+// with uniform initializers. Other variables, e.g. declared in @outer body and assigned in @inner
+// loop, can have a value per thread
+class UniformExprChecker : public RecursiveASTVisitor<UniformExprChecker> {
+   public:
+    UniformExprChecker(SessionStage& s, const OklLoopInfo& topInner)
+        : _stage(s),
+          _ctx(s.getCompiler().getASTContext()),
+          _attrTypeMap(s.tryEmplaceUserCtx<AttributedTypeMap>()),
+          _topInner(topInner) {}
+
+    bool VisitDeclRefExpr(DeclRefExpr* expr) {
+        const auto* var = dyn_cast<VarDecl>(expr->getDecl());
+        if (!var) {
+            return true;
+        }
+        _uniform = isUniformVar(*var);
+        return _uniform;
+    }
+
+    bool VisitCallExpr(CallExpr*) {
+        _uniform = false;
+        return false;
+    }
+
+    bool isUniform(const Expr& expr) {
+        _uniform = !expr.HasSideEffects(_ctx);
+        if (_uniform) {
+            TraverseStmt(const_cast<Expr*>(&expr));
+        }
+        return _uniform;
+    }
+
+   private:
+    bool isUniformVar(const VarDecl& var) {
+        if (_attrTypeMap.has(_ctx, var.getType(), {EXCLUSIVE_ATTR_NAME})) {
+            return false;
+        }
+        auto& sm = _ctx.getSourceManager();
+        auto range = _topInner.stmt.getSourceRange();
+        if (sm.isPointWithin(var.getLocation(), range.getBegin(), range.getEnd())) {
+            return false;
+        }
+        if (var.getType().isConstQualified() && !var.getType()->isReferenceType()) {
+            const auto* init = var.getInit();
+            return init && UniformExprChecker(_stage, _topInner).isUniform(*init);
+        }
+        if (!isa<ParmVarDecl>(var) && !isOuterLoopVar(var)) {
+            return false;
+        }
+        return !VarWriteFinder(var).isWrittenIn(_topInner.stmt);
+    }
+
+    bool isOuterLoopVar(const VarDecl& var) const {
+        for (const auto* loop = _topInner.parent; loop; loop = loop->parent) {
+            if (loop->has(LoopType::Outer) && loop->var.varDecl == &var) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    SessionStage& _stage;
+    ASTContext& _ctx;
+    AttributedTypeMap& _attrTypeMap;
+    const OklLoopInfo& _topInner;
+    bool _uniform = true;
+};
+}  // namespace
+
+std::optional<AtomicReduction> matchAtomicReduction(SessionStage& s,
+                                                    const Stmt& stmt,
+                                                    const Attr& attr) {
+    const auto* binOp = dyn_cast<BinaryOperator>(&stmt);
+    if (!binOp) {
+        return std::nullopt;
+    }
+    auto it = COMBINE_OPS.find(binOp->getOpcode());
+    if (it == COMBINE_OPS.end()) {
+        return std::nullopt;
+    }
+
+    const auto* target = binOp->getLHS();
+    auto type = target->getType();
+    if (type->isDependentType() || !(type->isIntegerType() || type->isRealFloatingType()) ||
+        type->isBooleanType()) {
+        return std::nullopt;
+    }
+
+    auto& sema = s.tryEmplaceUserCtx<OklSemaCtx>();
+    auto* loop = sema.getLoopInfo();
+    auto* topInner = loop ? getTopInnerLoop(*loop) : nullptr;
+    auto& ctx = s.getCompiler().getASTContext();
+    if (!topInner || !isInLoopBody(ctx, stmt, *loop)) {
+        return std::nullopt;
+    }
+
+    // Smaller @inner loops of the kernel split leave part of the block idle
+    auto block = loop->getAttributedRoot()->getInnerSizes();
+    if (block.hasNullOpts() || topInner->getInnerSizes() != block ||
+        EarlyExitFinder().hasEarlyExit(*topInner->stmt.getBody())) {
+        return std::nullopt;
+    }
+
+    UniformExprChecker checker(s, *topInner);
+    if (!checker.isUniform(*target)) {
+        return std::nullopt;
+    }
+
+    // Semicolon is replaced too, since the statement becomes a block
+    auto& sm = ctx.getSourceManager();
+    auto begin = getAttrFullSourceRange(attr).getBegin();
+    auto afterSemi =
+        Lexer::findLocationAfterToken(binOp->getEndLoc(), tok::semi, sm, ctx.getLangOpts(), false);
+    auto range = afterSemi.isValid() ? CharSourceRange::getCharRange(begin, afterSemi)
+                                     : CharSourceRange::getTokenRange(begin, binOp->getEndLoc());
+
+    return AtomicReduction{
+        .target = target,
+        .value = binOp->getRHS(),
+        .op = binOp->getOpcode(),
+        .combineOp = it->second,
+        .type = type.getUnqualifiedType().getAsString(ctx.getPrintingPolicy()),
+        .block = block,
+        .range = range,
+    };
+}
+
+}  // namespace oklt
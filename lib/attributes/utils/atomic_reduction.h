@@ -0,0 +1,51 @@
+#pragma once
+
+#include "core/sema/okl_sema_info.h"
+
+#include <clang/AST/OperationKinds.h>
+#include <clang/Basic/SourceLocation.h>
+
+#include <optional>
+#include <string>
+
+namespace clang {
+class Attr;
+class Expr;
+class Stmt;
+}  // namespace clang
+
+namespace oklt {
+
+class SessionStage;
+
+/**
+ * @struct AtomicReduction
+ * @brief This structure represents `@atomic target op= value;` statement, that is executed once by
+ * every thread of the block and updates the same target in all of them.
+ */
+struct AtomicReduction {
+    const clang::Expr* target;     ///< Updated expression, same for all threads.
+    const clang::Expr* value;      ///< Value of the thread.
+    clang::BinaryOperatorKind op;  ///< Compound assignment of the statement.
+    std::string combineOp;         ///< Operator that combines values of two threads.
+    std::string type;              ///< Type of the target.
+    OklLoopInfo::OptSizes block;   ///< Known sizes of the thread block.
+    clang::CharSourceRange range;  ///< Source range of the attribute and statement with semicolon.
+};
+
+/**
+ * @brief Checks if @atomic statement can be reduced across threads before the atomic operation:
+ * it is an associative compound assignment (`+=`, `-=`, `&=`, `|=`, `^=`) to an arithmetic target,
+ * the statement is placed directly in the body of an @inner loop, that is nested only into @inner
+ * loops up to @outer and is executed exactly once by every thread of the block, and the target
+ * doesn't depend on the thread.
+ * @param s The session stage.
+ * @param stmt The statement under @atomic attribute.
+ * @param attr The @atomic attribute.
+ * @return Matched reduction or nullopt.
+ */
+std::optional<AtomicReduction> matchAtomicReduction(SessionStage& s,
+                                                    const clang::Stmt& stmt,
+                                                    const clang::Attr& attr);
+
+}  // namespace oklt
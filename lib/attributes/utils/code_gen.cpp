@@ -72,9 +72,10 @@ HandleResult replaceAttributedLoop(SessionStage& s,
         auto body = dyn_cast_or_null<CompoundStmt>(f.getBody());
         if (body) {
             rewriter.RemoveText(SourceRange{f.getForLoc(), f.getRParenLoc()});
+            // Loop variable is declared before the code hoisted by child statements
             rewriter.InsertText(body->getLBracLoc().getLocWithOffset(1),
                                 std::string("\n") + prefixCode,
-                                true,
+                                false,
                                 true);
             rewriter.InsertText(f.getEndLoc(), suffixCode, true, true);
         } else {
@@ -1,5 +1,7 @@
+#include "attributes/utils/atomic_reduction.h"
 #include "core/handler_manager/result.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
 #include "core/utils/attributes.h"
 #include "core/utils/range_to_string.h"
 #include "pipeline/core/error_codes.h"
@@ -99,6 +101,56 @@ HandleResult handleCXXCopyOp(SessionStage& stage,
     return {};
 }
 
+// Index of the thread in the block, warps are made of consecutive indices
+std::string getLinearThreadIdx(const OklLoopInfo::OptSizes& block) {
+    if (block[1] == 1 && block[2] == 1) {
+        return "threadIdx.x";
+    }
+    return "((threadIdx.z * " + std::to_string(*block[1]) + " + threadIdx.y) * " +
+           std::to_string(*block[0]) + " + threadIdx.x)";
+}
+
+// Values are combined over the warp with shuffles and its first lane issues a single atomic:
+// `{ T r = value; for (...) { r = r op shfl_down(r, offset); } if (lane == 0) { atomic(&t, r); } }`
+bool tryReduceOverWarp(SessionStage& stage,
+                       const Stmt& stmt,
+                       const Attr& attr,
+                       const BinOpMapT& binaryConvertMap) {
+    if (!stage.getSession().getInput().reduceUniformAtomics) {
+        return false;
+    }
+    auto reduction = matchAtomicReduction(stage, stmt, attr);
+    if (!reduction) {
+        return false;
+    }
+
+    bool isHip = stage.getBackend() == TargetBackend::HIP;
+    auto warpSize = stage.getWavefrontSize();
+    if (reduction->block.product() % warpSize != 0) {
+        return false;
+    }
+
+    auto& ctx = stage.getCompiler().getASTContext();
+    auto shfl = isHip ? "__shfl_down(_occa_reduce, _occa_offset)"
+                      : "__shfl_down_sync(0xffffffff, _occa_reduce, _occa_offset)";
+    auto lane = getLinearThreadIdx(reduction->block) + " % " + std::to_string(warpSize);
+    auto atomicFunc = binaryConvertMap.at(reduction->op);
+
+    std::string code = "{\n";
+    code += reduction->type + " _occa_reduce = " + getSourceText(*reduction->value, ctx) + ";\n";
+    code += "for (int _occa_offset = " + std::to_string(warpSize / 2) +
+            "; _occa_offset > 0; _occa_offset /= 2) {\n";
+    code += "_occa_reduce = _occa_reduce " + reduction->combineOp + " " + shfl + ";\n";
+    code += "}\n";
+    code += "if (" + lane + " == 0) {\n";
+    code += atomicFunc + "(&(" + getSourceText(*reduction->target, ctx) + "), _occa_reduce);\n";
+    code += "}\n";
+    code += "}";
+
+    stage.getRewriter().ReplaceText(reduction->range, code);
+    return true;
+}
+
 }  // namespace
 
 namespace oklt::cuda_subset {
@@ -119,6 +171,10 @@ HandleResult handleAtomicAttribute(SessionStage& stage, const Stmt& stmt, const
         {UnaryOperatorKind::UO_PostInc, "atomicInc"},
     };
 
+    if (tryReduceOverWarp(stage, stmt, attr, atomicBinaryMap)) {
+        return {};
+    }
+
     auto& ctx = stage.getCompiler().getASTContext();
     if (const auto binOp = dyn_cast_or_null<BinaryOperator>(&stmt)) {
         return handleBinOp(stage, *binOp, attr, atomicBinaryMap);
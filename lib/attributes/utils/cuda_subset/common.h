@@ -2,4 +2,5 @@
 
 namespace oklt::cuda_subset {
 const std::string SYNC_THREADS_BARRIER = "__syncthreads()";
+const std::string DYNAMIC_SHARED_BUFFER = "_occa_shared_mem";
 }
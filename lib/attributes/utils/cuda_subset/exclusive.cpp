@@ -37,6 +37,15 @@ HandleResult handleExclusiveAttribute(SessionStage& stage,
             "Using [@exclusive] with typedef doesn't have proper semantic validation yet");
     }
 
+    const auto* var = clang::dyn_cast<clang::VarDecl>(&decl);
+    // Runtime sized arrays are not taken into account
+    auto type = var ? var->getType() : clang::QualType{};
+    if (var && !type->isDependentType() && !type->isVariablyModifiedType()) {
+        auto& ctx = stage.getCompiler().getASTContext();
+        loopInfo->getAttributedRoot()->staticMemory.exclusiveBytes +=
+            ctx.getTypeSizeInChars(type).getQuantity();
+    }
+
     stage.getRewriter().RemoveText(getAttrFullSourceRange(attr));
     return defaultHandleExclusiveDeclAttribute(stage, decl, attr);
 }
@@ -36,7 +36,7 @@ HandleResult handleInnerAttribute(SessionStage& s,
     updatedParams.axis = loopInfo->axis.front();
 
     std::string afterRBraceCode = "";
-    if (loopInfo->shouldSync()) {
+    if (shouldSyncAfterLoop(s, *loopInfo)) {
         afterRBraceCode += cuda_subset::SYNC_THREADS_BARRIER + ";\n";
     }
 
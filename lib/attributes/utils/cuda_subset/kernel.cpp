@@ -1,4 +1,5 @@
 #include "attributes/attribute_names.h"
+#include "attributes/utils/cuda_subset/common.h"
 #include "attributes/utils/cuda_subset/handle.h"
 #include "attributes/utils/kernel_utils.h"
 #include "core/handler_manager/handler_manager.h"
@@ -12,18 +13,64 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+
 namespace {
 using namespace clang;
 using namespace oklt;
 
 const std::string KERNEL_DEFINITION = "extern \"C\" __global__";
 const std::string KERNEL_BOUNDS = "__launch_bounds__({})";
+const std::string KERNEL_BOUNDS_MIN_BLOCKS = "__launch_bounds__({}, {})";
+const std::string DYNAMIC_SHARED_DECL = "extern __shared__ __align__({}) unsigned char {}[];\n";
+
+// Runtime computes the size from argument values, so arguments are referred by index too
+DynamicSharedBytes getDynamicSharedBytes(const OklLoopInfo::DynamicSharedLayout& layout,
+                                         const std::vector<ArgumentInfo>& args) {
+    DynamicSharedBytes bytes{.constant = layout.boundBytes};
+    for (const auto& [param, scale] : layout.argBytes) {
+        auto name = param->getNameAsString();
+        auto it = std::find_if(
+            args.begin(), args.end(), [&](const ArgumentInfo& arg) { return arg.name == name; });
+        if (scale != 0 && it != args.end()) {
+            bytes.terms.push_back({.arg = name,
+                                   .index = static_cast<size_t>(std::distance(args.begin(), it)),
+                                   .scale = scale});
+        }
+    }
+    std::sort(bytes.terms.begin(), bytes.terms.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.index < rhs.index;
+    });
+    return bytes;
+}
 
 std::string getFunctionName(const FunctionDecl& func, size_t n) {
     return util::fmt("_occa_{}_{}", func.getNameAsString(), n).value();
 }
 
-std::string getFunctionAttributesStr([[maybe_unused]] const FunctionDecl& func, OklLoopInfo* info) {
+// hip-clang takes the second argument of __launch_bounds__ as minimum waves per execution unit
+const size_t HIP_EU_PER_CU = 4;
+
+size_t getMinBlocksBound(SessionStage& s, size_t threads, size_t minBlocks) {
+    if (s.getBackend() != TargetBackend::HIP) {
+        return minBlocks;
+    }
+    auto wavefrontSize = s.getWavefrontSize();
+    auto waves = minBlocks * ((threads + wavefrontSize - 1) / wavefrontSize);
+    return std::max<size_t>(1, (waves + HIP_EU_PER_CU - 1) / HIP_EU_PER_CU);
+}
+
+// CUDA warps are always 32 threads, AMD GPUs run either 32 or 64 threads wavefronts
+bool isValidWavefrontSize(TargetBackend backend, size_t size) {
+    if (backend == TargetBackend::HIP) {
+        return size == 32 || size == 64;
+    }
+    return size == getDefaultWavefrontSize(backend);
+}
+
+std::string getFunctionAttributesStr(SessionStage& s,
+                                     [[maybe_unused]] const FunctionDecl& func,
+                                     OklLoopInfo* info) {
     std::stringstream out;
     out << KERNEL_DEFINITION;
 
@@ -31,7 +78,16 @@ std::string getFunctionAttributesStr([[maybe_unused]] const FunctionDecl& func,
         auto sizes = info->getInnerSizes();
         if (!sizes.hasNullOpts()) {
             auto prod = sizes.product();
-            out << " " << util::fmt(KERNEL_BOUNDS, prod).value();
+            if (info->minBlocks) {
+                auto minBlocks = getMinBlocksBound(s, prod, *info->minBlocks);
+                out << " " << util::fmt(KERNEL_BOUNDS_MIN_BLOCKS, prod, minBlocks).value();
+            } else {
+                out << " " << util::fmt(KERNEL_BOUNDS, prod).value();
+            }
+        } else if (info->minBlocks) {
+            s.pushWarning(
+                "[@min_blocks] is ignored since @inner loop sizes are unknown, use "
+                "[@max_inner_dims]");
         }
     }
 
@@ -39,6 +95,38 @@ std::string getFunctionAttributesStr([[maybe_unused]] const FunctionDecl& func,
     return out.str();
 }
 
+OccupancyInfo getOccupancyInfo(SessionStage& s, OklLoopInfo& info) {
+    OccupancyInfo ret;
+    ret.wavefrontSize = static_cast<int>(s.getWavefrontSize());
+    auto sizes = info.getInnerSizes();
+    if (!sizes.hasNullOpts()) {
+        ret.threadsPerBlock = static_cast<int>(sizes.product());
+    }
+    ret.minBlocks = info.minBlocks.value_or(-1);
+    ret.sharedBytes = info.staticMemory.sharedBytes;
+    ret.exclusiveBytes = info.staticMemory.exclusiveBytes;
+    return ret;
+}
+
+// Fused loop runs in the same blocks, so static @shared of all fused loops is allocated at once
+void mergeFusedMetadata(KernelInfo& meta,
+                        const OccupancyInfo& occupancy,
+                        const OklLoopInfo& info) {
+    if (meta.occupancy) {
+        meta.occupancy->sharedBytes += occupancy.sharedBytes;
+        meta.occupancy->exclusiveBytes =
+            std::max(meta.occupancy->exclusiveBytes, occupancy.exclusiveBytes);
+    }
+    meta.sharedPadding.insert(info.sharedPadding.begin(), info.sharedPadding.end());
+    if (info.coalescing) {
+        auto& coalescing = meta.coalescing ? *meta.coalescing : meta.coalescing.emplace();
+        coalescing.coalesced += info.coalescing->coalesced;
+        coalescing.strided += info.coalescing->strided;
+        coalescing.scattered += info.coalescing->scattered;
+    }
+    meta.fusedOuterLoops = std::max<size_t>(meta.fusedOuterLoops, 1) + 1;
+}
+
 std::string getFunctionParamStr(const FunctionDecl& func, oklt::Rewriter& r) {
     auto typeLoc = func.getFunctionTypeLoc();
     return r.getRewrittenText(typeLoc.getParensRange());
@@ -60,10 +148,21 @@ HandleResult handleKernelAttribute(SessionStage& s, const FunctionDecl& func, co
         return tl::make_unexpected(Error{OkltPipelineErrorCode::INTERNAL_ERROR_KERNEL_INFO_NULL,
                                          "handleKernelAttribute"});
     }
+    if (!isValidWavefrontSize(s.getBackend(), s.getWavefrontSize())) {
+        return tl::make_unexpected(Error{{},
+                                         "Wavefront size " + std::to_string(s.getWavefrontSize()) +
+                                             " is not supported by " +
+                                             backendToString(s.getBackend()) + " backend"});
+    }
 
     auto kernelInfo = *sema.getParsingKernelInfo();
     auto& kernels = sema.getProgramMetaData().kernels;
 
+    applyReadOnlyParams(s, kernelInfo);
+    markReadOnlyArgs(kernelInfo, *oklKernelInfo);
+    applyConstantParams(s, kernelInfo);
+    dropConstantArgs(s, kernelInfo, *oklKernelInfo);
+
     auto typeStr = rewriter.getRewrittenText(func.getReturnTypeSourceRange());
     auto paramStr = getFunctionParamStr(func, rewriter);
 
@@ -73,22 +172,45 @@ HandleResult handleKernelAttribute(SessionStage& s, const FunctionDecl& func, co
 
     auto startPos = getAttrFullSourceRange(a).getBegin();
     size_t n = 0;
+    auto variantSuffix = getKernelVariantSuffix(s);
     for (auto* child : kernelInfo.topLevelOuterLoops) {
         if (!child) {
             continue;
         }
+        if (child->fusedWithPrevious && n != 0) {
+            handleChildAttr(s, child->stmt, MAX_INNER_DIMS_NAME);
+            mergeFusedMetadata(kernels.back(), getOccupancyInfo(s, *child), *child);
+
+            // Blocks finish the previous loop before the next one reads its results
+            auto endPos = getAttrFullSourceRange(*child->attr).getBegin();
+            rewriter.ReplaceText(SourceRange{startPos, endPos},
+                                 "\n" + SYNC_THREADS_BARRIER + ";\n");
+
+            auto body = dyn_cast_or_null<CompoundStmt>(child->stmt.getBody());
+            startPos = (body ? body->getEndLoc() : child->stmt.getRParenLoc()).getLocWithOffset(1);
+            continue;
+        }
         kernels.push_back(oklKernelInfo.value());
         auto& meta = kernels.back();
-        meta.name = getFunctionName(func, n);
+        meta.name = getFunctionName(func, n) + variantSuffix;
 
         handleChildAttr(s, child->stmt, MAX_INNER_DIMS_NAME);
+        meta.occupancy = getOccupancyInfo(s, *child);
+        meta.sharedPadding = child->sharedPadding;
+        meta.coalescing = child->coalescing;
 
         std::stringstream out;
         if (n != 0) {
             out << "}\n\n";
         }
-        out << getFunctionAttributesStr(func, child);
-        out << typeStr << " " << getFunctionName(func, n) << paramStr << " {\n";
+        out << getFunctionAttributesStr(s, func, child);
+        out << typeStr << " " << meta.name << paramStr << " {\n";
+        out << getConstantParamsDecl(kernelInfo);
+        if (child->dynamicShared) {
+            const auto& layout = *child->dynamicShared;
+            out << util::fmt(DYNAMIC_SHARED_DECL, layout.align, DYNAMIC_SHARED_BUFFER).value();
+            meta.sharedBytes = getDynamicSharedBytes(layout, meta.args);
+        }
 
         auto endPos = getAttrFullSourceRange(*child->attr).getBegin();
         rewriter.ReplaceText(SourceRange{startPos, endPos}, out.str());
@@ -1,17 +1,288 @@
+#include "attributes/utils/cuda_subset/common.h"
 #include "attributes/utils/default_handlers.h"
+#include "attributes/utils/shared_padding.h"
 #include "core/handler_manager/result.h"
 #include "core/sema/okl_sema_ctx.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
 #include "core/utils/attributes.h"
+#include "core/utils/constant_params.h"
+#include "core/utils/range_to_string.h"
+
+#include "util/string_utils.hpp"
 
 #include <clang/AST/Attr.h>
 #include <clang/AST/DeclBase.h>
+#include <clang/AST/ParentMapContext.h>
+#include <clang/AST/TypeLoc.h>
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <cctype>
+#include <map>
+
 namespace {
+using namespace clang;
+using namespace oklt;
+
 const std::string SHARED_MODIFIER = "__shared__";
+
+std::optional<size_t> toConstant(const std::string& str) {
+    if (str.empty() || !std::all_of(str.begin(), str.end(), ::isdigit)) {
+        return std::nullopt;
+    }
+    return util::parseStrTo<size_t>(str);
+}
+
+std::string alignUp(const std::string& offset, size_t align) {
+    if (auto value = toConstant(offset)) {
+        return std::to_string((*value + align - 1) / align * align);
+    }
+    if (align <= 1) {
+        return offset;
+    }
+    return util::fmt("(({}) + {}) / {} * {}", offset, align - 1, align, align).value();
+}
+
+std::string addBytes(const std::string& lhs, const std::string& rhs) {
+    auto lhsValue = toConstant(lhs);
+    auto rhsValue = toConstant(rhs);
+    if (lhsValue && rhsValue) {
+        return std::to_string(*lhsValue + *rhsValue);
+    }
+    if (lhsValue && *lhsValue == 0) {
+        return rhs;
+    }
+    return lhs + " + " + rhs;
+}
+
+// Size of the buffer is evaluated by the host from kernel arguments, so the runtime extent can
+// refer only to them
+bool isHostEvaluable(const Stmt& stmt, const FunctionDecl& kernel) {
+    if (const auto* ref = dyn_cast<DeclRefExpr>(&stmt)) {
+        const auto* param = dyn_cast<ParmVarDecl>(ref->getDecl());
+        return param && param->getDeclContext() == &kernel;
+    }
+    return std::all_of(stmt.child_begin(), stmt.child_end(), [&](const Stmt* child) {
+        return !child || isHostEvaluable(*child, kernel);
+    });
+}
+
+// Runtime needs the size as a number per unit of each argument, so the extent must be an affine
+// combination of integer arguments with constant coefficients
+bool collectArgTerms(const Expr& expr,
+                     int64_t scale,
+                     const ASTContext& ctx,
+                     const OklKernelInfo& kernelInfo,
+                     int64_t& constant,
+                     std::map<const ParmVarDecl*, int64_t>& terms) {
+    const auto* e = expr.IgnoreParenImpCasts();
+    if (auto value = evaluateWithConstantParams(*e, ctx, kernelInfo.constantParams)) {
+        constant += scale * *value;
+        return true;
+    }
+    if (const auto* ref = dyn_cast<DeclRefExpr>(e)) {
+        const auto* param = dyn_cast<ParmVarDecl>(ref->getDecl());
+        if (!param || !param->getType()->isIntegerType()) {
+            return false;
+        }
+        terms[param] += scale;
+        return true;
+    }
+    if (const auto* unOp = dyn_cast<UnaryOperator>(e)) {
+        return unOp->getOpcode() == UO_Minus &&
+               collectArgTerms(*unOp->getSubExpr(), -scale, ctx, kernelInfo, constant, terms);
+    }
+    const auto* binOp = dyn_cast<BinaryOperator>(e);
+    if (!binOp) {
+        return false;
+    }
+    const auto* lhs = binOp->getLHS();
+    const auto* rhs = binOp->getRHS();
+    switch (binOp->getOpcode()) {
+        case BO_Add:
+        case BO_Sub:
+            return collectArgTerms(*lhs, scale, ctx, kernelInfo, constant, terms) &&
+                   collectArgTerms(*rhs,
+                                   binOp->getOpcode() == BO_Sub ? -scale : scale,
+                                   ctx,
+                                   kernelInfo,
+                                   constant,
+                                   terms);
+        case BO_Mul: {
+            auto value = evaluateWithConstantParams(*rhs, ctx, kernelInfo.constantParams);
+            if (value) {
+                std::swap(lhs, rhs);
+            } else {
+                value = evaluateWithConstantParams(*lhs, ctx, kernelInfo.constantParams);
+            }
+            return value && collectArgTerms(*rhs, scale * *value, ctx, kernelInfo, constant, terms);
+        }
+        default:
+            return false;
+    }
+}
+
+// Declarators of one statement share the type specifier, that is replaced by the view
+bool isSingleDeclarator(ASTContext& ctx, const VarDecl& var) {
+    auto parents = ctx.getParents(var);
+    const auto* declStmt = parents.size() == 1 ? parents[0].get<DeclStmt>() : nullptr;
+    return !declStmt || declStmt->isSingleDecl();
+}
+
+// Replaces `T x[E0][E1];` with a view into the kernel dynamic shared memory buffer:
+// `T (*x)[E1] = reinterpret_cast<T (*)[E1]>(_occa_shared_mem + offset);`
+HandleResult lowerToDynamicShared(SessionStage& s,
+                                  const VarDecl& var,
+                                  QualType type,
+                                  const Attr& a,
+                                  OklLoopInfo& outer,
+                                  const OklKernelInfo& kernelInfo) {
+    auto& ctx = s.getCompiler().getASTContext();
+    auto& sm = ctx.getSourceManager();
+    auto& rewriter = s.getRewriter();
+    const auto& kernel = kernelInfo.decl.get();
+
+    if (!isSingleDeclarator(ctx, var)) {
+        return tl::make_unexpected(
+            Error{{}, "Dynamic [@shared] variables must be declared one per statement"});
+    }
+
+    // Only the first extent can be a runtime value, e.g. sized by kernel argument
+    std::vector<std::string> extents;
+    int64_t rowsConstant = 0;
+    std::map<const ParmVarDecl*, int64_t> rowsTerms;
+    while (const auto* arrayType = ctx.getAsArrayType(type)) {
+        if (const auto* constArray = dyn_cast<ConstantArrayType>(arrayType)) {
+            extents.push_back(std::to_string(constArray->getSize().getZExtValue()));
+        } else if (const auto* varArray = dyn_cast<VariableArrayType>(arrayType);
+                   varArray && extents.empty()) {
+            const auto* sizeExpr = varArray->getSizeExpr();
+            if (!sizeExpr || !isHostEvaluable(*sizeExpr, kernel)) {
+                return tl::make_unexpected(Error{
+                    {}, "Runtime extent of dynamic [@shared] array must refer only to arguments"});
+            }
+            if (!collectArgTerms(*sizeExpr, 1, ctx, kernelInfo, rowsConstant, rowsTerms)) {
+                return tl::make_unexpected(
+                    Error{{},
+                          "Runtime extent of dynamic [@shared] array must be an affine expression "
+                          "of integer arguments"});
+            }
+            extents.push_back("(" + getLatestSourceText(*sizeExpr, rewriter) + ")");
+        } else {
+            return tl::make_unexpected(Error{
+                {}, "Only the first extent of dynamic [@shared] array can be a runtime value"});
+        }
+        type = arrayType->getElementType();
+    }
+
+    auto elemSize = static_cast<size_t>(ctx.getTypeSizeInChars(type).getQuantity());
+    auto align = static_cast<size_t>(ctx.getTypeAlignInChars(type).getQuantity());
+    auto typeStr = type.getAsString(ctx.getPrintingPolicy());
+
+    size_t constBytes = elemSize;
+    for (size_t i = 0; i < extents.size(); ++i) {
+        if (auto extent = toConstant(extents[i])) {
+            constBytes *= *extent;
+        }
+    }
+    auto bytes = std::to_string(constBytes);
+    if (!extents.empty() && !toConstant(extents.front())) {
+        bytes = extents.front() + " * " + bytes;
+    }
+
+    auto& layout = outer.dynamicShared ? *outer.dynamicShared : outer.dynamicShared.emplace();
+    auto offset = alignUp(layout.bytes, align);
+    layout.bytes = addBytes(offset, bytes);
+    layout.align = std::max(layout.align, align);
+
+    // Alignment of the offset keeps the bound linear, if argument terms are already aligned,
+    // otherwise it takes at most `align - 1` bytes
+    auto signedAlign = static_cast<int64_t>(align);
+    auto isAligned = layout.boundBytes >= 0 &&
+                     std::all_of(layout.argBytes.begin(), layout.argBytes.end(), [&](auto& term) {
+                         return term.second % signedAlign == 0;
+                     });
+    layout.boundBytes = isAligned
+                            ? (layout.boundBytes + signedAlign - 1) / signedAlign * signedAlign
+                            : layout.boundBytes + signedAlign - 1;
+    // Bytes of the array are bytes of the row times the first extent, if it is a runtime value
+    auto rowBytes = static_cast<int64_t>(constBytes);
+    if (!toConstant(bytes)) {
+        layout.boundBytes += rowsConstant * rowBytes;
+        for (const auto& [param, coef] : rowsTerms) {
+            layout.argBytes[param] += coef * rowBytes;
+        }
+    } else {
+        layout.boundBytes += rowBytes;
+    }
+
+    auto name = var.getNameAsString();
+    auto ptr = cuda_subset::DYNAMIC_SHARED_BUFFER + " + " + offset;
+    std::string declStr;
+    if (extents.empty()) {
+        declStr = typeStr + "& " + name + " = *reinterpret_cast<" + typeStr + "*>(" + ptr + ")";
+    } else {
+        std::string rows;
+        for (size_t i = 1; i < extents.size(); ++i) {
+            rows += "[" + extents[i] + "]";
+        }
+        auto ptrType = rows.empty() ? typeStr + "*" : typeStr + " (*)" + rows;
+        auto varStr = rows.empty() ? typeStr + "* " + name : typeStr + " (*" + name + ")" + rows;
+        declStr = varStr + " = reinterpret_cast<" + ptrType + ">(" + ptr + ")";
+    }
+
+    // Attribute can be placed both before and after the declarator
+    auto attrRange = getAttrFullSourceRange(a);
+    auto begin = sm.isBeforeInTranslationUnit(attrRange.getBegin(), var.getBeginLoc())
+                     ? attrRange.getBegin()
+                     : var.getBeginLoc();
+    auto end = sm.isBeforeInTranslationUnit(var.getEndLoc(), attrRange.getEnd())
+                   ? attrRange.getEnd()
+                   : var.getEndLoc();
+    rewriter.ReplaceText(SourceRange{begin, end}, declStr);
+
+    return defaultHandleSharedDeclAttribute(s, var, a);
+}
+
+// Rewrites the innermost extent of the declarator to the one of padded type
+bool padStaticShared(SessionStage& s, const VarDecl& var, QualType paddedType) {
+    auto& ctx = s.getCompiler().getASTContext();
+    const auto* typeInfo = var.getTypeSourceInfo();
+    if (!typeInfo) {
+        return false;
+    }
+
+    std::optional<ArrayTypeLoc> innerLoc;
+    auto loc = typeInfo->getTypeLoc();
+    for (;;) {
+        if (auto attributedLoc = loc.getAs<AttributedTypeLoc>()) {
+            loc = attributedLoc.getModifiedLoc();
+        } else if (auto arrayLoc = loc.getAs<ArrayTypeLoc>()) {
+            innerLoc = arrayLoc;
+            loc = arrayLoc.getElementLoc();
+        } else {
+            break;
+        }
+    }
+
+    const ConstantArrayType* innerType = nullptr;
+    for (auto type = paddedType; const auto* arrayType = ctx.getAsConstantArrayType(type);
+         type = arrayType->getElementType()) {
+        innerType = arrayType;
+    }
+    if (!innerLoc || !innerType) {
+        return false;
+    }
+
+    auto range = ctx.getSourceManager().getExpansionRange(innerLoc->getBracketsRange());
+    s.getRewriter().ReplaceText(range,
+                                "[" + std::to_string(innerType->getSize().getZExtValue()) + "]");
+    return true;
 }
+}  // namespace
+
 namespace oklt::cuda_subset {
 HandleResult handleSharedAttribute(SessionStage& s, const clang::Decl& d, const clang::Attr& a) {
     SPDLOG_DEBUG("Handle [@shared] attribute");
@@ -42,6 +313,49 @@ HandleResult handleSharedAttribute(SessionStage& s, const clang::Decl& d, const
         s.pushWarning("Using [@shared] with typedef doesn't have proper semantic validation yet");
     }
 
+    // Variables of typedef @shared types stay in static shared memory
+    const auto* var = clang::dyn_cast<clang::VarDecl>(&d);
+    auto type = var ? var->getType() : clang::QualType{};
+    size_t padding = 0;
+    if (var && !type->isDependentType()) {
+        auto& ctx = s.getCompiler().getASTContext();
+        padding = getSharedBankPadding(s, *var, a, *loopInfo);
+        if (padding) {
+            type = getPaddedSharedType(ctx, type, padding);
+        }
+    }
+
+    if (var && s.getSession().getInput().dynamicShared) {
+        if (!type->isDependentType()) {
+            auto root = loopInfo->getAttributedRoot();
+            if (padding) {
+                root->sharedPadding[var->getNameAsString()] = padding;
+            }
+            // All @shared variables of the kernel split are packed into one buffer
+            auto* kernelInfo = sema.getParsingKernelInfo();
+            if (!kernelInfo) {
+                return tl::make_unexpected(
+                    Error{{}, "[@shared] failed to fetch kernel meta data from sema"});
+            }
+            return lowerToDynamicShared(s, *var, type, a, *root, *kernelInfo);
+        }
+        s.pushWarning("[@shared] variable of dependent type '" + var->getNameAsString() +
+                      "' is kept in static shared memory");
+    }
+
+    if (padding && padStaticShared(s, *var, type)) {
+        loopInfo->getAttributedRoot()->sharedPadding[var->getNameAsString()] = padding;
+    } else if (var) {
+        type = var->getType();
+    }
+
+    // Runtime sized arrays are not taken into account
+    if (var && !type->isDependentType() && !type->isVariablyModifiedType()) {
+        auto& ctx = s.getCompiler().getASTContext();
+        loopInfo->getAttributedRoot()->staticMemory.sharedBytes +=
+            ctx.getTypeSizeInChars(type).getQuantity();
+    }
+
     s.getRewriter().ReplaceText(getAttrFullSourceRange(a), replacedAttribute);
 
     return defaultHandleSharedDeclAttribute(s, d, a);
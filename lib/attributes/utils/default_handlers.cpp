@@ -27,14 +27,7 @@ HandleResult defaultHandleSharedStmtAttribute(SessionStage& stage,
                                               const clang::Attr& a) {
     SPDLOG_DEBUG("Called empty {} stmt handler", a.getNormalizedFullName());
 
-    auto& sema = stage.tryEmplaceUserCtx<OklSemaCtx>();
-    auto* currLoop = sema.getLoopInfo();
-    if (!currLoop) {
-        return {};
-    }
-
-    currLoop->markSharedUsed();
-
+    // Reads and writes of @shared variables are collected by sema into OklLoopInfo::sharedAccesses
     return {};
 }
 
@@ -3,14 +3,18 @@
 #include "attributes/attribute_names.h"
 #include "core/handler_manager/handler_manager.h"
 #include "core/sema/okl_sema_info.h"
+#include "core/transpiler_session/kernel_variants.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
 #include "pipeline/core/error_codes.h"
 #include <oklt/core/kernel_metadata.h>
 
 #include <clang/AST/ParentMapContext.h>
+#include <clang/Lex/Lexer.h>
 
 #include <spdlog/fmt/fmt.h>
 
+#include <algorithm>
 #include <deque>
 #include <tl/expected.hpp>
 
@@ -18,6 +22,15 @@ namespace oklt {
 using namespace clang;
 
 namespace {
+bool hasRestrictAttr(const ParmVarDecl& param) {
+    for (const auto* attr : param.attrs()) {
+        if (attr && attr->getNormalizedFullName() == RESTRICT_ATTR_NAME) {
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  * @brief A structure representing a node in the loop tree.
  */
@@ -254,4 +267,116 @@ tl::expected<std::any, Error> handleChildAttr(SessionStage& s,
     return {};
 }
 
+bool shouldSyncAfterLoop(SessionStage& s, OklLoopInfo& loopInfo) {
+    if (loopInfo.shouldSync()) {
+        return true;
+    }
+    if (loopInfo.isSyncElided()) {
+        s.pushNote("barrier after [@inner] loop is elided: next loop has no conflicting accesses "
+                   "to [@shared] memory",
+                   loopInfo.stmt.getEndLoc());
+    }
+    return false;
+}
+
+void applyReadOnlyParams(SessionStage& s, const OklKernelInfo& kernelInfo) {
+    auto& rewriter = s.getRewriter();
+    // Parameters are visited in declaration order, not in order of their addresses
+    for (const auto* param : kernelInfo.decl.get().parameters()) {
+        if (!kernelInfo.readOnlyParams.count(param)) {
+            continue;
+        }
+        auto pointee = param->getType()->getPointeeType();
+        if (!pointee.isConstQualified()) {
+            rewriter.InsertTextBefore(param->getTypeSpecStartLoc(), "const ");
+        }
+        // Explicit @restrict is rewritten by its own handler
+        if (!param->getType().isRestrictQualified() && !hasRestrictAttr(*param)) {
+            rewriter.InsertTextBefore(param->getLocation(), "__restrict__ ");
+        }
+    }
+}
+
+void markReadOnlyArgs(const OklKernelInfo& kernelInfo, KernelInfo& meta) {
+    for (const auto* param : kernelInfo.readOnlyParams) {
+        for (auto& arg : meta.args) {
+            if (arg.name == param->getNameAsString()) {
+                arg.is_const = true;
+            }
+        }
+    }
+}
+
+void applyConstantParams(SessionStage& s, const OklKernelInfo& kernelInfo) {
+    const auto& constants = kernelInfo.constantParams;
+    if (constants.empty()) {
+        return;
+    }
+
+    auto& rewriter = s.getRewriter();
+    if (!s.getSession().getInput().dropConstantArgs) {
+        // Signature is kept, the name is declared as a constant of the body instead
+        for (const auto* param : kernelInfo.decl.get().parameters()) {
+            if (constants.count(param)) {
+                rewriter.RemoveText(SourceRange{param->getLocation()});
+            }
+        }
+        return;
+    }
+
+    // Every run of dropped parameters is removed together with the separating commas
+    auto& sm = s.getCompiler().getSourceManager();
+    const auto& opts = s.getCompiler().getLangOpts();
+    auto params = kernelInfo.decl.get().parameters();
+    for (size_t i = 0; i < params.size();) {
+        if (!constants.count(params[i])) {
+            ++i;
+            continue;
+        }
+        auto first = i;
+        while (i < params.size() && constants.count(params[i])) {
+            ++i;
+        }
+        auto begin = params[first]->getBeginLoc();
+        auto end = Lexer::getLocForEndOfToken(params[i - 1]->getEndLoc(), 0, sm, opts);
+        if (i < params.size()) {
+            end = params[i]->getBeginLoc();
+        } else if (first > 0) {
+            begin = Lexer::getLocForEndOfToken(params[first - 1]->getEndLoc(), 0, sm, opts);
+        }
+        rewriter.RemoveText(CharSourceRange::getCharRange(begin, end));
+    }
+}
+
+void dropConstantArgs(SessionStage& s, const OklKernelInfo& kernelInfo, KernelInfo& meta) {
+    if (!s.getSession().getInput().dropConstantArgs) {
+        return;
+    }
+    for (const auto& [param, value] : kernelInfo.constantParams) {
+        auto name = param->getNameAsString();
+        meta.args.erase(std::remove_if(meta.args.begin(),
+                                       meta.args.end(),
+                                       [&name](const auto& arg) { return arg.name == name; }),
+                        meta.args.end());
+    }
+}
+
+std::string getConstantParamsDecl(const OklKernelInfo& kernelInfo) {
+    std::string out;
+    for (const auto* param : kernelInfo.decl.get().parameters()) {
+        auto it = kernelInfo.constantParams.find(param);
+        if (it == kernelInfo.constantParams.end()) {
+            continue;
+        }
+        out += "constexpr " + param->getType().getUnqualifiedType().getAsString() + " " +
+               param->getNameAsString() + " = " + std::to_string(it->second) + ";\n";
+    }
+    return out;
+}
+
+std::string getKernelVariantSuffix(SessionStage& s) {
+    const auto& current = s.tryEmplaceUserCtx<KernelVariants>().current;
+    return current ? "_v" + std::to_string(*current) : std::string();
+}
+
 }  // namespace oklt
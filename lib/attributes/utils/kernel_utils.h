@@ -14,4 +14,43 @@ const clang::AttributedStmt* getAttributedStmt(SessionStage& s, const clang::Stm
 tl::expected<std::any, Error> handleChildAttr(SessionStage& s,
                                               const clang::Stmt& stmt,
                                               std::string_view name);
+
+/**
+ * @brief Checks if a barrier should be inserted after the @inner loop. Barrier elided by @shared
+ * memory hazard analysis is reported as a note.
+ */
+bool shouldSyncAfterLoop(SessionStage& s, OklLoopInfo& loopInfo);
+
+/**
+ * @brief Adds `const` and `__restrict__` to the kernel parameters that sema found read-only.
+ */
+void applyReadOnlyParams(SessionStage& s, const OklKernelInfo& kernelInfo);
+
+/**
+ * @brief Marks arguments of kernel metadata that sema found read-only as const.
+ */
+void markReadOnlyArgs(const OklKernelInfo& kernelInfo, KernelInfo& meta);
+
+/**
+ * @brief Rewrites kernel parameters bound to compile-time values: with
+ * `UserInput::dropConstantArgs` they are removed from the signature, otherwise left unnamed.
+ */
+void applyConstantParams(SessionStage& s, const OklKernelInfo& kernelInfo);
+
+/**
+ * @brief Removes arguments of kernel metadata bound to compile-time values, if they are dropped
+ * from the signature.
+ */
+void dropConstantArgs(SessionStage& s, const OklKernelInfo& kernelInfo, KernelInfo& meta);
+
+/**
+ * @brief Declares kernel parameters bound to compile-time values as constants of the kernel body.
+ */
+std::string getConstantParamsDecl(const OklKernelInfo& kernelInfo);
+
+/**
+ * @brief Suffix of names of kernels generated for the current point of `UserInput::tuningGrid`,
+ * empty for the default kernels.
+ */
+std::string getKernelVariantSuffix(SessionStage& s);
 }  // namespace oklt
@@ -2,6 +2,9 @@
 #include "attributes/frontend/params/tile.h"
 #include "core/handler_manager/result.h"
 
+#include <functional>
+#include <string>
+
 namespace clang {
 class Attr;
 class Stmt;
@@ -15,13 +18,27 @@ class ParmVarDecl;
 
 namespace oklt {
 class SessionStage;
-}
+struct OklLoopInfo;
+}  // namespace oklt
 
 namespace oklt::serial_subset {
+/**
+ * @brief Builds a replacement of the `for (...)` header of the loop over tiles. Receives the loop,
+ * name of the tiled variable and already rewritten start, end and step (tile size times increment)
+ * strings. The opening `{` is appended by the caller.
+ */
+using TileLoopHeaderBuilder = std::function<std::string(const OklLoopInfo&,
+                                                        const std::string& tiledVar,
+                                                        const std::string& start,
+                                                        const std::string& end,
+                                                        const std::string& step)>;
+
 HandleResult handleTileAttribute(SessionStage&,
                                  const clang::ForStmt&,
                                  const clang::Attr&,
-                                 const TileParams*);
+                                 const TileParams*,
+                                 const std::string& remainderPrefix = "",
+                                 const TileLoopHeaderBuilder& firstLoopHeader = {});
 HandleResult handleInnerAttribute(SessionStage&,
                                   const clang::ForStmt&,
                                   const clang::Attr&,
@@ -1,3 +1,4 @@
+#include "attributes/utils/kernel_utils.h"
 #include "core/handler_manager/handler_manager.h"
 #include "core/sema/okl_sema_ctx.h"
 #include "core/transpiler_session/session_stage.h"
@@ -46,6 +47,10 @@ HandleResult handleKernelAttribute(SessionStage& s, const FunctionDecl& func, co
 
     auto& kernels = sema.getProgramMetaData().kernels;
     kernels.push_back(oklKernelInfo.value());
+    if (const auto* kernelInfo = sema.getParsingKernelInfo()) {
+        applyReadOnlyParams(s, *kernelInfo);
+        markReadOnlyArgs(*kernelInfo, kernels.back());
+    }
 
     return {};
 }
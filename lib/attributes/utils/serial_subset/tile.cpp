@@ -6,6 +6,7 @@
 #include "core/handler_manager/handler_manager.h"
 #include "core/sema/okl_sema_ctx.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
 #include "core/utils/attributes.h"
 #include "core/utils/range_to_string.h"
 
@@ -24,6 +25,41 @@ std::string getTiledVariableName(const OklLoopInfo& forLoop) {
     return "_occa_tiled_" + forLoop.var.name;
 }
 
+std::string getRemainderVariableName(const OklLoopInfo& forLoop) {
+    return getTiledVariableName(forLoop) + "_rem";
+}
+
+std::string getTileStepStr(const OklLoopInfo& forLoop,
+                           const TileParams* params,
+                           oklt::Rewriter& rewriter) {
+    if (!forLoop.inc.val) {
+        return params->tileSize;
+    }
+    return util::fmt("({} * {})", params->tileSize, getLatestSourceText(forLoop.inc.val, rewriter))
+        .value();
+}
+
+// INFO: the peeled remainder duplicates the loop body and computes the first not full tile with
+//      division, so it's limited to signed loops with a compound body and no @exclusive indexing
+bool shouldPeelRemainder(SessionStage& s, OklLoopInfo& forLoop, const TileParams* params) {
+    if (!params->check || !params->peel.value_or(s.getSession().getInput().peelTileRemainder)) {
+        return false;
+    }
+
+    if (!forLoop.var.varDecl || !forLoop.var.varDecl->getType()->isSignedIntegerType()) {
+        return false;
+    }
+
+    if (!isa_and_nonnull<CompoundStmt>(forLoop.stmt.getBody())) {
+        return false;
+    }
+
+    auto hasExclusive = [](OklLoopInfo& v) {
+        return v.exclusiveInfo.declared || v.exclusiveInfo.used;
+    };
+    return !hasExclusive(forLoop) && !forLoop.getAttributedParent(hasExclusive);
+}
+
 std::string getScopesCloseStr(size_t& parenCnt) {
     std::string ret;
     while (parenCnt--) {
@@ -36,15 +72,26 @@ std::string buildFirstLoopString([[maybe_unused]] const ForStmt& stmt,
                                  const OklLoopInfo& forLoop,
                                  [[maybe_unused]] const TileParams* params,
                                  size_t& parenCnt,
-                                 oklt::Rewriter& rewriter) {
+                                 oklt::Rewriter& rewriter,
+                                 bool peelRemainder,
+                                 const TileLoopHeaderBuilder& firstLoopHeader) {
     auto tiledVar = getTiledVariableName(forLoop);
     auto assignUpdate = forLoop.IsInc() ? "+=" : "-=";
     auto cmpOpStr = getCondCompStr(forLoop.condition.op);
-    auto incValStr = params->tileSize;
-    if (forLoop.inc.val) {
-        incValStr =
-            util::fmt("({} * {})", params->tileSize, getLatestSourceText(forLoop.inc.val, rewriter))
-                .value();
+    auto endStr = getLatestSourceText(forLoop.range.end, rewriter);
+    auto incValStr = getTileStepStr(forLoop, params, rewriter);
+
+    // Only full tiles are left in the main loop, remainder is already peeled
+    if (peelRemainder) {
+        cmpOpStr = forLoop.IsInc() ? "<" : ">";
+        endStr = getRemainderVariableName(forLoop);
+    }
+
+    // Backend specific header replaces the whole `for (...)`
+    if (firstLoopHeader) {
+        auto startStr = "(" + getLatestSourceText(forLoop.range.start, rewriter) + ")";
+        ++parenCnt;
+        return firstLoopHeader(forLoop, tiledVar, startStr, endStr, incValStr) + " {\n";
     }
 
     // Do not include `for` statement as it's already present.
@@ -55,7 +102,7 @@ std::string buildFirstLoopString([[maybe_unused]] const ForStmt& stmt,
                          getLatestSourceText(forLoop.range.start, rewriter),
                          tiledVar,
                          cmpOpStr,
-                         getLatestSourceText(forLoop.range.end, rewriter),
+                         endStr,
                          tiledVar,
                          assignUpdate,
                          incValStr)
@@ -71,8 +118,8 @@ std::string buildSecondLoopString(const ForStmt& stmt,
                                   const OklLoopInfo& forLoop,
                                   const TileParams* params,
                                   size_t& parenCnt,
-                                  oklt::Rewriter& rewriter) {
-    auto tiledVar = getTiledVariableName(forLoop);
+                                  oklt::Rewriter& rewriter,
+                                  const std::string& tiledVar) {
     auto op = forLoop.IsInc() ? "+" : "-";
     auto cmp = forLoop.IsInc() ? "<" : ">";
 
@@ -136,12 +183,70 @@ std::string buildCheckString(const ForStmt& stmt,
     return ret;
 }
 
+// Single tile with bound checks, that starts where the main loop of full tiles stops.
+//  {
+//  const int _occa_tiled_i_rem = (start) + ((end) - (start)) / (step) * (step);
+//  <remainderPrefix>
+//  if ((start) < (end)) {
+//      for (int i = _occa_tiled_i_rem; i < (_occa_tiled_i_rem + N); ++i) {
+//          if (i < (end)) { <body> }
+//      }
+//  }
+//  <main loop>
+//  }
+std::string buildRemainderString(const ForStmt& stmt,
+                                 const OklLoopInfo& forLoop,
+                                 const TileParams* params,
+                                 oklt::Rewriter& rewriter,
+                                 const std::string& remainderPrefix) {
+    auto remVar = getRemainderVariableName(forLoop);
+    auto startStr = getLatestSourceText(forLoop.range.start, rewriter);
+    auto endStr = getLatestSourceText(forLoop.range.end, rewriter);
+    auto stepStr = getTileStepStr(forLoop, params, rewriter);
+    auto cmpStr = getCondCompStr(forLoop.condition.op);
+
+    std::string ret = "{\n";
+    if (forLoop.IsInc()) {
+        ret += util::fmt("const {} {} = ({}) + (({}) - ({})) / ({}) * ({});\n",
+                         forLoop.var.typeName,
+                         remVar,
+                         startStr,
+                         endStr,
+                         startStr,
+                         stepStr,
+                         stepStr)
+                   .value();
+    } else {
+        ret += util::fmt("const {} {} = ({}) - (({}) - ({})) / ({}) * ({});\n",
+                         forLoop.var.typeName,
+                         remVar,
+                         startStr,
+                         startStr,
+                         endStr,
+                         stepStr,
+                         stepStr)
+                   .value();
+    }
+    ret += remainderPrefix;
+    ret += util::fmt("if (({}) {} ({}))", startStr, cmpStr, endStr).value() + " {\n";
+
+    size_t parenCnt = 1;
+    ret += buildSecondLoopString(stmt, forLoop, params, parenCnt, rewriter, remVar);
+    ret += buildCheckString(stmt, forLoop, params, parenCnt, rewriter);
+    ret += getLatestSourceText(stmt.getBody(), rewriter) + "\n";
+    ret += getScopesCloseStr(parenCnt);
+
+    return ret;
+}
+
 }  // namespace
 
 HandleResult handleTileAttribute(SessionStage& s,
                                  const ForStmt& stmt,
                                  const Attr& a,
-                                 const TileParams* params) {
+                                 const TileParams* params,
+                                 const std::string& remainderPrefix,
+                                 const TileLoopHeaderBuilder& firstLoopHeader) {
     SPDLOG_DEBUG("Handle [@tile] attribute");
 
     if (!params) {
@@ -168,11 +273,24 @@ HandleResult handleTileAttribute(SessionStage& s,
         }
     }
 
+    // Peeled remainder goes before the loop, so it doesn't need a check anymore
+    auto peelRemainder = shouldPeelRemainder(s, *loopInfo, params);
+    TileParams mainParams = *params;
+    if (peelRemainder) {
+        rewriter.InsertText(stmt.getBeginLoc(),
+                            buildRemainderString(stmt, *loopInfo, params, rewriter, remainderPrefix),
+                            false,
+                            true);
+        mainParams.check = false;
+        params = &mainParams;
+    }
+
     size_t parenCnt = 0;
     std::string prefixCode;
 
     // First loop. usually `@outer`
-    prefixCode += buildFirstLoopString(stmt, *loopInfo, params, parenCnt, rewriter);
+    prefixCode += buildFirstLoopString(
+        stmt, *loopInfo, params, parenCnt, rewriter, peelRemainder, firstLoopHeader);
 
     // `@tile(@outer, ...)` loop
     if (loopInfo->type[0] == LoopType::Outer) {
@@ -187,7 +305,8 @@ HandleResult handleTileAttribute(SessionStage& s,
     }
 
     // Second loop. usually `@inner`
-    prefixCode += buildSecondLoopString(stmt, *loopInfo, params, parenCnt, rewriter);
+    prefixCode += buildSecondLoopString(
+        stmt, *loopInfo, params, parenCnt, rewriter, getTiledVariableName(*loopInfo));
 
     // `@tile(@outer, ...)` loop
     if (loopInfo->type[0] == LoopType::Outer) {
@@ -204,7 +323,8 @@ HandleResult handleTileAttribute(SessionStage& s,
 
     // Replace `for` statement body from LParent to RParen.
     // It is done to avoid replacing the already modified body with insertions before/after.
-    rewriter.ReplaceText(SourceRange{stmt.getLParenLoc(), stmt.getRParenLoc()}, prefixCode);
+    auto headerBegin = firstLoopHeader ? stmt.getForLoc() : stmt.getLParenLoc();
+    rewriter.ReplaceText(SourceRange{headerBegin, stmt.getRParenLoc()}, prefixCode);
 
     // Bottom most `@inner` loop
     if (loopInfo->children.empty()) {
@@ -228,6 +348,8 @@ HandleResult handleTileAttribute(SessionStage& s,
         }
     }
 
+    // Close scope of the remainder variable
+    parenCnt += peelRemainder;
     std::string suffixCode = getScopesCloseStr(parenCnt);
     rewriter.InsertTextAfter(stmt.getEndLoc(), suffixCode);
 
@@ -0,0 +1,225 @@
+#include "attributes/frontend/params/shared.h"
+#include "attributes/utils/shared_padding.h"
+#include "core/handler_manager/handler_manager.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
+
+#include <clang/AST/AST.h>
+#include <clang/AST/ParentMapContext.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+
+#include <algorithm>
+#include <set>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+// Shared memory is interleaved by 4 bytes wide banks
+const size_t BANK_WIDTH = 4;
+
+// Element is only loaded or stored, e.g. its address, that exposes the layout, is not taken
+bool isLoadOrStore(ASTContext& ctx, const Expr& element) {
+    const Expr* current = &element;
+    for (;;) {
+        auto parents = ctx.getParents(*current);
+        const auto* parent = parents.size() == 1 ? parents[0].get<Expr>() : nullptr;
+        if (!parent) {
+            return false;
+        }
+        if (isa<ParenExpr>(parent)) {
+            current = parent;
+            continue;
+        }
+        if (const auto* cast = dyn_cast<ImplicitCastExpr>(parent)) {
+            return cast->getCastKind() == CK_LValueToRValue;
+        }
+        if (const auto* binOp = dyn_cast<BinaryOperator>(parent)) {
+            return binOp->isAssignmentOp() && binOp->getLHS() == current;
+        }
+        if (const auto* unOp = dyn_cast<UnaryOperator>(parent)) {
+            return unOp->isIncrementDecrementOp();
+        }
+        return false;
+    }
+}
+
+// Subscripts of the array element, outermost first. Empty if the array is used in other way
+std::vector<const Expr*> getElementSubscripts(ASTContext& ctx,
+                                              const DeclRefExpr& ref,
+                                              size_t rank) {
+    std::vector<const Expr*> subscripts;
+    const Expr* current = &ref;
+    while (subscripts.size() < rank) {
+        auto parents = ctx.getParents(*current);
+        if (parents.size() != 1) {
+            return {};
+        }
+        const auto* parent = parents[0].get<Expr>();
+        if (!parent) {
+            return {};
+        }
+        if (isa<ParenExpr, ImplicitCastExpr>(parent)) {
+            current = parent;
+            continue;
+        }
+        const auto* subscript = dyn_cast<ArraySubscriptExpr>(parent);
+        if (!subscript || subscript->getBase() != current) {
+            return {};
+        }
+        subscripts.push_back(subscript->getIdx());
+        current = parent;
+    }
+    return isLoadOrStore(ctx, *current) ? subscripts : std::vector<const Expr*>{};
+}
+
+class SharedUseVisitor : public RecursiveASTVisitor<SharedUseVisitor> {
+   public:
+    SharedUseVisitor(ASTContext& ctx, const VarDecl& var, size_t rank)
+        : _ctx(ctx),
+          _var(var),
+          _rank(rank) {}
+
+    bool VisitDeclRefExpr(DeclRefExpr* ref) {
+        if (ref->getDecl() != &_var) {
+            return true;
+        }
+        auto subscripts = getElementSubscripts(_ctx, *ref, _rank);
+        if (subscripts.empty()) {
+            _onlyElements = false;
+            return false;
+        }
+        _accesses.push_back(std::move(subscripts));
+        return true;
+    }
+
+    [[nodiscard]] bool onlyElements() const { return _onlyElements; }
+    [[nodiscard]] const std::vector<std::vector<const Expr*>>& accesses() const {
+        return _accesses;
+    }
+
+   private:
+    ASTContext& _ctx;
+    const VarDecl& _var;
+    size_t _rank;
+    bool _onlyElements = true;
+    std::vector<std::vector<const Expr*>> _accesses;
+};
+
+// Iteration variables of @inner loops along x axis, consecutive threads differ by them
+void collectThreadXVars(const OklLoopInfo& loop, std::set<const ValueDecl*>& vars) {
+    for (size_t i = 0; i < loop.type.size() && i < loop.axis.size(); ++i) {
+        if (loop.type[i] == LoopType::Inner && loop.axis[i] == Axis::X && loop.var.varDecl) {
+            vars.insert(loop.var.varDecl);
+        }
+    }
+    for (const auto& child : loop.children) {
+        collectThreadXVars(child, vars);
+    }
+}
+
+bool refersTo(const Stmt& stmt, const std::set<const ValueDecl*>& vars) {
+    if (const auto* ref = dyn_cast<DeclRefExpr>(&stmt)) {
+        return vars.count(ref->getDecl()) != 0;
+    }
+    return std::any_of(stmt.child_begin(), stmt.child_end(), [&vars](const Stmt* child) {
+        return child && refersTo(*child, vars);
+    });
+}
+
+// Threads along x axis access the same column, i.e. elements a row apart
+bool isStrided(const std::vector<const Expr*>& subscripts,
+               const std::set<const ValueDecl*>& threadXVars) {
+    if (refersTo(*subscripts.back(), threadXVars)) {
+        return false;
+    }
+    return std::any_of(subscripts.begin(), subscripts.end() - 1, [&](const Expr* subscript) {
+        return refersTo(*subscript, threadXVars);
+    });
+}
+}  // namespace
+
+size_t getSharedBankPadding(SessionStage& s,
+                            const VarDecl& var,
+                            const Attr& a,
+                            OklLoopInfo& outer) {
+    std::optional<bool> pad;
+    auto params = s.getAttrManager().parseAttr(s, a);
+    if (params && params->type() == typeid(AttributedShared)) {
+        pad = std::any_cast<AttributedShared>(params.value()).pad;
+    }
+    if (!pad.value_or(s.getSession().getInput().padSharedBanks)) {
+        return 0;
+    }
+    bool isForced = pad.value_or(false);
+
+    auto& ctx = s.getCompiler().getASTContext();
+    auto notPadded = [&](const std::string& reason) -> size_t {
+        if (isForced) {
+            s.pushWarning("[@shared] array '" + var.getNameAsString() +
+                          "' is not padded: " + reason);
+        }
+        return 0;
+    };
+
+    auto elemType = var.getType();
+    if (elemType->isDependentType()) {
+        return notPadded("its type is dependent");
+    }
+    size_t rank = 0;
+    size_t innerExtent = 0;
+    while (const auto* arrayType = ctx.getAsConstantArrayType(elemType)) {
+        ++rank;
+        innerExtent = arrayType->getSize().getZExtValue();
+        elemType = arrayType->getElementType();
+    }
+    if (rank < 2 || ctx.getAsArrayType(elemType)) {
+        return notPadded("it is not a multi-dimensional array of constant size");
+    }
+
+    // Consecutive rows already start in different banks
+    auto elemSize = static_cast<size_t>(ctx.getTypeSizeInChars(elemType).getQuantity());
+    auto rowBytes = innerExtent * elemSize;
+    if (!elemSize || rowBytes % BANK_WIDTH != 0 || (rowBytes / BANK_WIDTH) % 2 != 0) {
+        return 0;
+    }
+
+    // Layout of the array can be observed by any use other than access to its element
+    SharedUseVisitor visitor(ctx, var, rank);
+    visitor.TraverseStmt(const_cast<Stmt*>(outer.stmt.getBody()));
+    if (!visitor.onlyElements()) {
+        return notPadded("it is used other than by element subscripts");
+    }
+
+    if (!isForced) {
+        std::set<const ValueDecl*> threadXVars;
+        collectThreadXVars(outer, threadXVars);
+        const auto& accesses = visitor.accesses();
+        if (std::none_of(accesses.begin(), accesses.end(), [&](const auto& subscripts) {
+                return isStrided(subscripts, threadXVars);
+            })) {
+            return 0;
+        }
+    }
+
+    // Shift every next row by one bank
+    return std::max<size_t>(1, BANK_WIDTH / elemSize);
+}
+
+QualType getPaddedSharedType(ASTContext& ctx, QualType type, size_t padding) {
+    const auto* arrayType = ctx.getAsConstantArrayType(type);
+    if (!arrayType || !padding) {
+        return type;
+    }
+
+    auto elemType = arrayType->getElementType();
+    auto size = arrayType->getSize();
+    if (ctx.getAsConstantArrayType(elemType)) {
+        elemType = getPaddedSharedType(ctx, elemType, padding);
+    } else {
+        size += padding;
+    }
+    return ctx.getConstantArrayType(elemType, size, nullptr, ArrayType::Normal, 0);
+}
+
+}  // namespace oklt
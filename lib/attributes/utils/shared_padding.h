@@ -0,0 +1,44 @@
+#pragma once
+
+#include "core/sema/okl_sema_info.h"
+
+#include <clang/AST/Type.h>
+
+namespace clang {
+class ASTContext;
+class Attr;
+class VarDecl;
+}  // namespace clang
+
+namespace oklt {
+
+class SessionStage;
+
+/**
+ * @brief Computes number of elements appended to the innermost extent of multi-dimensional
+ * @shared array, so that threads of @inner loop along x axis don't hit the same memory bank.
+ * With `UserInput::padSharedBanks` array is padded, if x axis index is used only in outer
+ * subscripts (column-wise or transposed access). `@shared(pad)` pads the array regardless of the
+ * access pattern, `@shared(nopad)` disables padding. Array is never padded if it is used other
+ * than by element subscripts, e.g. in `sizeof`, `@dim` view or as a pointer.
+ * @param s The session stage.
+ * @param var The @shared array.
+ * @param a The @shared attribute.
+ * @param outer The @outer loop, that declares the array.
+ * @return Number of padding elements, 0 if array isn't padded.
+ */
+size_t getSharedBankPadding(SessionStage& s,
+                            const clang::VarDecl& var,
+                            const clang::Attr& a,
+                            OklLoopInfo& outer);
+
+/**
+ * @brief Builds type of padded @shared array.
+ * @param ctx The AST context.
+ * @param type The type of @shared array.
+ * @param padding Number of elements appended to the innermost extent.
+ * @return Array type with the innermost extent increased by padding.
+ */
+clang::QualType getPaddedSharedType(clang::ASTContext& ctx, clang::QualType type, size_t padding);
+
+}  // namespace oklt
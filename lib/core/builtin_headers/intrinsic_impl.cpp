@@ -3,6 +3,7 @@
 #include "core/builtin_headers/okl_intrinsic_dpcpp.h"
 #include "core/builtin_headers/okl_intrinsic_hip.h"
 #include "core/builtin_headers/okl_intrinsic_host.h"
+#include "core/builtin_headers/okl_threads_runtime.h"
 
 #include <clang/Frontend/CompilerInstance.h>
 #include "core/transpiler_session/transpiler_session.h"
@@ -26,6 +27,7 @@ IntrinsicInfo getIntrinsicInfo(TargetBackend backend) {
         case TargetBackend::HIP:
             return IntrinsicInfo{std::string(INTRINSIC_HIP), {}};
         case TargetBackend::OPENMP:
+        case TargetBackend::THREADS:
         case TargetBackend::SERIAL:
         case TargetBackend::_LAUNCHER:
             return IntrinsicInfo{std::string(INTRINSIC_HOST),
@@ -39,6 +41,27 @@ IntrinsicInfo getIntrinsicInfo(TargetBackend backend) {
     }
 }
 
+// Runtime support that transpiled kernels rely on regardless of the okl_intrinsic.h usage
+IntrinsicInfo getRuntimeInfo(TargetBackend backend) {
+    switch (backend) {
+        case TargetBackend::THREADS:
+            return IntrinsicInfo{std::string(THREADS_RUNTIME),
+                                 {
+                                     "algorithm",
+                                     "atomic",
+                                     "condition_variable",
+                                     "cstdlib",
+                                     "deque",
+                                     "memory",
+                                     "mutex",
+                                     "thread",
+                                     "vector",
+                                 }};
+        default:
+            return {{}, {}};
+    }
+}
+
 void addInstrinsicStub(TranspilerSession& session, clang::CompilerInstance& compiler) {
     auto& headers = session.getStagedHeaders();
     headers.emplace(INTRINSIC_INCLUDE_FILENAME, std::string());
@@ -68,4 +91,10 @@ std::vector<std::string> embedInstrinsic(std::string& input, TargetBackend backe
     return info.includes;
 }
 
+std::vector<std::string> embedBackendRuntime(std::string& input, TargetBackend backend) {
+    auto info = getRuntimeInfo(backend);
+    input.insert(0, info.source);
+    return info.includes;
+}
+
 }  // namespace oklt
@@ -17,4 +17,7 @@ void addInstrinsicStub(TranspilerSession &session,
 std::vector<std::string> embedInstrinsic(std::string &input,
                                          TargetBackend backend);
 
+std::vector<std::string> embedBackendRuntime(std::string &input,
+                                             TargetBackend backend);
+
 }  // namespace oklt
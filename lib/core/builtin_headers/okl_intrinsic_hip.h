@@ -2,6 +2,11 @@
 #pragma once
 
 static constexpr const char INTRINSIC_HIP[] = R"delim(
+// Wavefront size the kernel is generated for, AMD GPUs run either 32 or 64 threads wavefronts
+#ifndef OKL_WAVEFRONT_SIZE
+#define OKL_WAVEFRONT_SIZE warpSize
+#endif
+
 namespace {
 
 //Single presicion
@@ -10,30 +15,30 @@ inline __device__ float okl_exp10f (float x) {
     return exp10f(x);
 }
 
-// Warp Shuffle Functions
+// Warp Shuffle Functions, mask has a bit per thread of the wavefront
 template<class T>
-inline __device__ T okl_shfl_sync(unsigned mask, T var, int srcLane, int width=warpSize)
+inline __device__ T okl_shfl_sync(unsigned long long mask, T var, int srcLane, int width=OKL_WAVEFRONT_SIZE)
 {
     return __shfl_sync(mask, var, srcLane, width);
 }
 
 template<class T>
-inline __device__ T okl_shfl_up_sync(unsigned mask, T var, unsigned int delta, int width=warpSize)
+inline __device__ T okl_shfl_up_sync(unsigned long long mask, T var, unsigned int delta, int width=OKL_WAVEFRONT_SIZE)
 {
     return __shfl_up_sync(mask, var, delta, width);
 }
 
 template<class T>
-inline __device__ T okl_shfl_down_sync(unsigned mask, T var, unsigned int delta, int width=warpSize)
+inline __device__ T okl_shfl_down_sync(unsigned long long mask, T var, unsigned int delta, int width=OKL_WAVEFRONT_SIZE)
 {
     return __shfl_down_sync(mask, var, delta, width);
 }
 
 template<class T>
 inline __device__
-    T okl_shfl_xor_sync(unsigned mask, T var, int laneMask, int width=warpSize)
+    T okl_shfl_xor_sync(unsigned long long mask, T var, int laneMask, int width=OKL_WAVEFRONT_SIZE)
 {
-    return __shfl_xor_sync(mask, laneMask, width);
+    return __shfl_xor_sync(mask, var, laneMask, width);
 }
 
 
@@ -9,6 +9,8 @@
 #include <clang/AST/Attr.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+
 namespace oklt {
 using namespace clang;
 
@@ -17,8 +19,8 @@ HandlerMap& HandlerManager::_map() {
     return m;
 };
 
-tl::expected<std::set<const Attr*>, Error> HandlerManager::checkAttrs(SessionStage& stage,
-                                                                      const DynTypedNode& node) {
+tl::expected<std::vector<const Attr*>, Error> HandlerManager::checkAttrs(SessionStage& stage,
+                                                                         const DynTypedNode& node) {
     auto backend = stage.getBackend();
     auto kind = node.getNodeKind();
     if (ASTNodeKind::getFromNodeKind<Decl>().isBaseOf(kind)) {
@@ -29,11 +31,10 @@ tl::expected<std::set<const Attr*>, Error> HandlerManager::checkAttrs(SessionSta
 
         const auto& attrs = decl.getAttrs();
 
-        // in case of multiple same attribute take the last one
-        std::set<const Attr*> collectedAttrs;
-        for (auto it = attrs.rbegin(); it != attrs.rend(); ++it) {
-            const auto& attr = *it;
-
+        // Attributes are kept in source order, so handlers rewrite the node in the same order on
+        // every run regardless of where the attributes were allocated
+        std::vector<const Attr*> collectedAttrs;
+        for (const auto* attr : attrs) {
             if (!attr || !isOklAttribute(*attr)) {
                 continue;
             }
@@ -50,8 +51,11 @@ tl::expected<std::set<const Attr*>, Error> HandlerManager::checkAttrs(SessionSta
                 return tl::make_unexpected(Error{.ec = std::error_code(), .desc = "no handler"});
             }
 
-            auto [_, isNew] = collectedAttrs.insert(attr);
-            if (!isNew) {
+            auto isNew = std::find(collectedAttrs.begin(), collectedAttrs.end(), attr) ==
+                         collectedAttrs.end();
+            if (isNew) {
+                collectedAttrs.push_back(attr);
+            } else {
                 // TODO convince OCCA community to specify such case as forbidden
                 SPDLOG_ERROR(
                     "{} multi declaration of attribute: {} for decl: {}",
@@ -69,7 +73,7 @@ tl::expected<std::set<const Attr*>, Error> HandlerManager::checkAttrs(SessionSta
         auto subKind = ASTNodeKind::getFromNode(*stmt.getSubStmt());
 
         const auto& attrs = cast<AttributedStmt>(stmt).getAttrs();
-        std::set<const Attr*> collectedAttrs;
+        std::vector<const Attr*> collectedAttrs;
         for (const auto attr : attrs) {
             if (!attr || !isOklAttribute(*attr)) {
                 continue;
@@ -86,8 +90,11 @@ tl::expected<std::set<const Attr*>, Error> HandlerManager::checkAttrs(SessionSta
                 return tl::make_unexpected(Error{.ec = std::error_code(), .desc = "no handler"});
             }
 
-            auto [_, isNew] = collectedAttrs.insert(attr);
-            if (!isNew) {
+            auto isNew = std::find(collectedAttrs.begin(), collectedAttrs.end(), attr) ==
+                         collectedAttrs.end();
+            if (isNew) {
+                collectedAttrs.push_back(attr);
+            } else {
                 // TODO convince OCCA community to specify such case as forbidden
                 SPDLOG_ERROR(
                     "{} multi declaration of attribute: {} for stmt: {}",
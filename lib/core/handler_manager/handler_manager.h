@@ -12,6 +12,7 @@
 
 #include <any>
 #include <set>
+#include <vector>
 
 namespace oklt {
 
@@ -52,8 +53,9 @@ class HandlerManager {
                                                      const clang::DynTypedNode& node,
                                                      const clang::Attr* attr);
 
-    tl::expected<std::set<const clang::Attr*>, Error> checkAttrs(SessionStage& stage,
-                                                                 const clang::DynTypedNode& node);
+    tl::expected<std::vector<const clang::Attr*>, Error> checkAttrs(
+        SessionStage& stage,
+        const clang::DynTypedNode& node);
 
    private:
     static HandlerMap& _map();
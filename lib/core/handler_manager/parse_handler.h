@@ -1,10 +1,12 @@
 #pragma once
 
 #include "core/handler_manager/handler_manager.h"
+#include "core/transpiler_session/okl_attr_index.h"
 #include "util/type_traits.h"
 
 #include <clang/AST/ASTTypeTraits.h>
 #include <clang/AST/Attr.h>
+#include <clang/Sema/ParsedAttr.h>
 #include <tl/expected.hpp>
 
 #include <any>
@@ -52,9 +54,34 @@ struct HandlerKey<T, std::enable_if_t<T == HandleType::PARSER>> : public HandleK
     }
 };
 
+// Records every accepted attribute in the OklAttrIndex of the stage being parsed
+template <typename AttrFrontendType>
+struct IndexedAttrInfo : public AttrFrontendType {
+    bool diagAppertainsToDecl(clang::Sema& sema,
+                              const clang::ParsedAttr& attr,
+                              const clang::Decl* decl) const override {
+        if (!AttrFrontendType::diagAppertainsToDecl(sema, attr, decl)) {
+            return false;
+        }
+        indexOklAttr(sema, decl, attr.getLoc());
+        return true;
+    }
+
+    bool diagAppertainsToStmt(clang::Sema& sema,
+                              const clang::ParsedAttr& attr,
+                              const clang::Stmt* stmt) const override {
+        if (!AttrFrontendType::diagAppertainsToStmt(sema, attr, stmt)) {
+            return false;
+        }
+        indexOklAttr(sema, nullptr, attr.getLoc());
+        return true;
+    }
+};
+
 template <typename AttrFrontendType, typename F>
 inline bool registerAttrFrontend(std::string attr, F& func) {
-    static clang::ParsedAttrInfoRegistry::Add<AttrFrontendType> register_okl_atomic(attr, "");
+    static clang::ParsedAttrInfoRegistry::Add<IndexedAttrInfo<AttrFrontendType>>
+        register_okl_atomic(attr, "");
     return HandlerManager::_map().insert(HandlerKey<HandleType::PARSER>(attr), func);
 };
 
@@ -6,6 +6,8 @@
 
 #include <tl/expected.hpp>
 
+#include <map>
+
 namespace oklt {
 using json = nlohmann::json;
 
@@ -128,13 +130,158 @@ void from_json(const json& j, ArgumentInfo& argInfo) {
     j.at("ptr").get_to(argInfo.is_ptr);
 }
 
+std::optional<ScheduleKind> scheduleKindFromString(const std::string& str) {
+    static const std::map<std::string, ScheduleKind> SCHEDULE_KINDS_MAP = {
+        {"default", ScheduleKind::Default},
+        {"static", ScheduleKind::Static},
+        {"dynamic", ScheduleKind::Dynamic},
+        {"guided", ScheduleKind::Guided},
+        {"auto", ScheduleKind::Auto},
+        {"runtime", ScheduleKind::Runtime},
+    };
+
+    auto it = SCHEDULE_KINDS_MAP.find(str);
+    if (it != SCHEDULE_KINDS_MAP.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+std::optional<ProcBind> procBindFromString(const std::string& str) {
+    static const std::map<std::string, ProcBind> PROC_BINDS_MAP = {
+        {"default", ProcBind::Default},
+        {"primary", ProcBind::Primary},
+        {"master", ProcBind::Primary},
+        {"close", ProcBind::Close},
+        {"spread", ProcBind::Spread},
+    };
+
+    auto it = PROC_BINDS_MAP.find(str);
+    if (it != PROC_BINDS_MAP.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+void to_json(json& j, const ScheduleInfo& schedule) {
+    j = json::object();
+    if (schedule.kind != ScheduleKind::Default) {
+        j["kind"] = toString(schedule.kind);
+    }
+    if (schedule.chunk > 0) {
+        j["chunk"] = schedule.chunk;
+    }
+    if (schedule.procBind != ProcBind::Default) {
+        j["proc_bind"] = toString(schedule.procBind);
+    }
+    if (schedule.numThreads > 0) {
+        j["num_threads"] = schedule.numThreads;
+    }
+}
+
+void from_json(const json& j, ScheduleInfo& schedule) {
+    schedule = ScheduleInfo{};
+    if (j.contains("kind")) {
+        schedule.kind =
+            scheduleKindFromString(j.at("kind").get<std::string>()).value_or(ScheduleKind::Default);
+    }
+    if (j.contains("chunk")) {
+        j.at("chunk").get_to(schedule.chunk);
+    }
+    if (j.contains("proc_bind")) {
+        schedule.procBind =
+            procBindFromString(j.at("proc_bind").get<std::string>()).value_or(ProcBind::Default);
+    }
+    if (j.contains("num_threads")) {
+        j.at("num_threads").get_to(schedule.numThreads);
+    }
+}
+
+void to_json(json& j, const OccupancyInfo& occupancy) {
+    j = json{{"static_shared_bytes", occupancy.sharedBytes},
+             {"exclusive_bytes", occupancy.exclusiveBytes}};
+    if (occupancy.threadsPerBlock > 0) {
+        j["threads_per_block"] = occupancy.threadsPerBlock;
+    }
+    if (occupancy.minBlocks > 0) {
+        j["min_blocks"] = occupancy.minBlocks;
+    }
+    if (occupancy.wavefrontSize > 0) {
+        j["wavefront_size"] = occupancy.wavefrontSize;
+    }
+}
+
+void from_json(const json& j, OccupancyInfo& occupancy) {
+    occupancy = OccupancyInfo{};
+    j.at("static_shared_bytes").get_to(occupancy.sharedBytes);
+    j.at("exclusive_bytes").get_to(occupancy.exclusiveBytes);
+    if (j.contains("threads_per_block")) {
+        j.at("threads_per_block").get_to(occupancy.threadsPerBlock);
+    }
+    if (j.contains("min_blocks")) {
+        j.at("min_blocks").get_to(occupancy.minBlocks);
+    }
+    if (j.contains("wavefront_size")) {
+        j.at("wavefront_size").get_to(occupancy.wavefrontSize);
+    }
+}
+
 void to_json(json& j, const KernelInfo& kernelMeta) {
     j = json{{"arguments", kernelMeta.args}, {"name", kernelMeta.name}};
+    // INFO: emitted only for non default policy to keep metadata of other backends untouched
+    if (!kernelMeta.schedules.empty()) {
+        j["schedule"] = kernelMeta.schedules;
+    }
+    if (!kernelMeta.firstTouch.empty()) {
+        j["first_touch"] = kernelMeta.firstTouch;
+    }
+    if (kernelMeta.sharedBytes) {
+        j["shared_bytes"] = *kernelMeta.sharedBytes;
+    }
+    if (!kernelMeta.sharedPadding.empty()) {
+        j["shared_padding"] = kernelMeta.sharedPadding;
+    }
+    if (kernelMeta.occupancy) {
+        j["occupancy"] = *kernelMeta.occupancy;
+    }
+    if (kernelMeta.coalescing) {
+        j["coalescing"] = *kernelMeta.coalescing;
+    }
+    if (kernelMeta.fusedOuterLoops > 0) {
+        j["fused_outer_loops"] = kernelMeta.fusedOuterLoops;
+    }
+    if (!kernelMeta.tuningValues.empty()) {
+        j["tuning_values"] = kernelMeta.tuningValues;
+    }
 }
 
 void from_json(const json& j, KernelInfo& kernelMeta) {
     j.at("arguments").get_to(kernelMeta.args);
     j.at("name").get_to(kernelMeta.name);
+    if (j.contains("schedule")) {
+        j.at("schedule").get_to(kernelMeta.schedules);
+    }
+    if (j.contains("first_touch")) {
+        j.at("first_touch").get_to(kernelMeta.firstTouch);
+    }
+    if (j.contains("shared_bytes")) {
+        kernelMeta.sharedBytes = j.at("shared_bytes").get<DynamicSharedBytes>();
+    }
+    if (j.contains("shared_padding")) {
+        j.at("shared_padding").get_to(kernelMeta.sharedPadding);
+    }
+    if (j.contains("occupancy")) {
+        kernelMeta.occupancy = j.at("occupancy").get<OccupancyInfo>();
+    }
+    if (j.contains("coalescing")) {
+        kernelMeta.coalescing = j.at("coalescing").get<CoalescingInfo>();
+    }
+    if (j.contains("fused_outer_loops")) {
+        j.at("fused_outer_loops").get_to(kernelMeta.fusedOuterLoops);
+    }
+    if (j.contains("tuning_values")) {
+        j.at("tuning_values").get_to(kernelMeta.tuningValues);
+    }
 }
 
 void to_json(json& j, const ProgramMetaData& programMeta) {
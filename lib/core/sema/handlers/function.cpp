@@ -3,6 +3,11 @@
 
 #include "core/sema/okl_sema_ctx.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
+#include "core/utils/coalescing.h"
+#include "core/utils/constant_params.h"
+#include "core/utils/outer_fusion.h"
+#include "core/utils/read_only_params.h"
 #include "function.h"
 
 #include <clang/AST/AST.h>
@@ -26,6 +31,11 @@ HandleResult preValidateOklKernel(SessionStage& stage,
             Error{.ec = std::error_code(), .desc = "nested OKL kernels are illegal"});
     }
 
+    if (stage.getSession().getInput().inferReadOnlyArgs) {
+        sema.getParsingKernelInfo()->readOnlyParams = collectReadOnlyParams(fd);
+    }
+    sema.getParsingKernelInfo()->constantParams = collectConstantParams(stage, fd);
+
     return {};
 }
 
@@ -34,6 +44,24 @@ HandleResult postValidateOklKernel(SessionStage& stage,
                                    const clang::Attr& attr) {
     // stop parsing of current kernel info and reset internal state of sema
     auto& sema = stage.tryEmplaceUserCtx<OklSemaCtx>();
+
+    // Loop axes are resolved, so that accesses are classified by threads along x axis. Host
+    // backends run @inner loops sequentially, so there is nothing to coalesce
+    auto* kernelInfo = sema.getParsingKernelInfo();
+    if (kernelInfo && stage.getSession().getInput().analyzeCoalescing &&
+        isDeviceCategory(stage.getBackend())) {
+        for (auto* outer : kernelInfo->topLevelOuterLoops) {
+            if (outer) {
+                analyzeCoalescing(stage, *outer);
+            }
+        }
+    }
+
+    // Launcher pass must take the same decision to launch every device kernel
+    if (kernelInfo && stage.getSession().getInput().fuseOuterLoops) {
+        fuseOuterLoops(stage, kernelInfo->topLevelOuterLoops);
+    }
+
     sema.stopParsingKernelInfo();
 
     return {};
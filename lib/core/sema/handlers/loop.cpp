@@ -1,16 +1,60 @@
 #include "loop.h"
+#include "attributes/attribute_names.h"
 #include "core/handler_manager/handler_manager.h"
 #include "core/sema/okl_sema_ctx.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/utils/shared_accesses.h"
 
 #include <clang/AST/AST.h>
 #include <clang/AST/Attr.h>
+#include <clang/AST/ParentMapContext.h>
+
+#include <algorithm>
 
 #include "spdlog/spdlog.h"
 
 namespace oklt {
 using namespace clang;
 
+namespace {
+// Barriers are placed only between loops that are not nested into @inner loops
+void collectLoopSharedAccesses(SessionStage& stage, OklSemaCtx& sema, const ForStmt& stmt) {
+    auto loopInfo = sema.getLoopInfo(stmt);
+    if (!loopInfo) {
+        return;
+    }
+    auto parent = loopInfo->getAttributedParent();
+    if (parent && !parent->has(LoopType::Inner)) {
+        loopInfo->sharedAccesses = collectSharedAccesses(stage, stmt);
+    }
+
+    // Statements around @inner loops run between barriers as well
+    const auto& children = loopInfo->children;
+    auto hasInnerChild = std::any_of(children.begin(), children.end(), [](const auto& child) {
+        return child.has(LoopType::Inner);
+    });
+    if (!loopInfo->has(LoopType::Inner) && hasInnerChild && stmt.getBody()) {
+        loopInfo->sharedAccessesBetween =
+            collectSharedAccessesBetween(stage, *stmt.getBody(), children);
+    }
+}
+
+bool hasOklLoopAttribute(SessionStage& stage, const ForStmt& stmt) {
+    auto parents = stage.getCompiler().getASTContext().getParents(stmt);
+    const auto* attributed = parents.size() == 1 ? parents[0].get<AttributedStmt>() : nullptr;
+    if (!attributed) {
+        return false;
+    }
+    for (const auto* attr : attributed->getAttrs()) {
+        auto name = attr ? attr->getNormalizedFullName() : std::string();
+        if (name == OUTER_ATTR_NAME || name == INNER_ATTR_NAME || name == TILE_ATTR_NAME) {
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
 HandleResult preValidateOklForLoop(SessionStage& stage,
                                    const ForStmt& stmt,
                                    const Attr& attr) {
@@ -62,6 +106,7 @@ HandleResult postValidateOklForLoop(SessionStage& stage,
     }
 
     auto& sema = stage.tryEmplaceUserCtx<OklSemaCtx>();
+    collectLoopSharedAccesses(stage, sema, stmt);
     auto ok = sema.stopParsingAttributedForLoop(stmt, &attr, &params.value());
     if (!ok) {
         // make appropriate error code
@@ -86,6 +131,7 @@ HandleResult postValidateOklForLoopWithoutAttribute(SessionStage& stage,
 
     SPDLOG_DEBUG("[Sema] Post validate loop without attribute");
 
+    collectLoopSharedAccesses(stage, sema, stmt);
     auto ok = sema.stopParsingAttributedForLoop(stmt, nullptr, nullptr);
     if (!ok) {
         // make appropriate error code
@@ -95,4 +141,24 @@ HandleResult postValidateOklForLoopWithoutAttribute(SessionStage& stage,
     return ok;
 }
 
+HandleResult preValidateOklRegularForLoop(SessionStage& stage,
+                                          const clang::ForStmt& stmt,
+                                          const Attr& attr) {
+    if (hasOklLoopAttribute(stage, stmt)) {
+        return tl::make_unexpected(
+            Error{{}, "[@" + attr.getNormalizedFullName().substr(OKL_ATTR_PREFIX.size()) +
+                          "] can't be applied to [@outer], [@inner] or [@tile] loops"});
+    }
+    return preValidateOklForLoopWithoutAttribute(stage, stmt, nullptr);
+}
+
+HandleResult postValidateOklRegularForLoop(SessionStage& stage,
+                                           const clang::ForStmt& stmt,
+                                           const Attr& attr) {
+    if (hasOklLoopAttribute(stage, stmt)) {
+        return {};
+    }
+    return postValidateOklForLoopWithoutAttribute(stage, stmt, nullptr);
+}
+
 }  // namespace oklt
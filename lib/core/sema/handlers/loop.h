@@ -28,5 +28,14 @@ HandleResult postValidateOklForLoopWithoutAttribute(SessionStage&,
                                                     const clang::ForStmt&,
                                                     const clang::Attr*);
 
+// validator for for loop under attribute, that keeps the loop regular, e.g. @unroll
+HandleResult preValidateOklRegularForLoop(SessionStage&,
+                                          const clang::ForStmt&,
+                                          const clang::Attr&);
+
+HandleResult postValidateOklRegularForLoop(SessionStage&,
+                                           const clang::ForStmt&,
+                                           const clang::Attr&);
+
 }  // namespace oklt
    // namespace oklt
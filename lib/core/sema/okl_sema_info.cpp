@@ -1,6 +1,7 @@
 #include "core/sema/okl_sema_info.h"
 
 #include <deque>
+#include <iterator>
 #include <numeric>
 #include <optional>
 #include "attributes/frontend/params/loop.h"
@@ -12,37 +13,98 @@ namespace oklt {
 //  sizes among all branches
 // #define LEGACY_INNER_SIZES_CALCULATION
 
-[[nodiscard]] bool OklLoopInfo::shouldSync() {
-    // 1. There should be shared memory usage somewhere inside loop
-    if (!sharedInfo.used || sharedInfo.nobarrierApplied) {
-        return false;
+namespace {
+using SharedAccesses = OklLoopInfo::SharedAccesses;
+
+void mergeSharedAccesses(SharedAccesses& to, const SharedAccesses& from) {
+    for (const auto& [var, access] : from) {
+        auto& merged = to[var];
+        merged.read = merged.read || access.read;
+        merged.write = merged.write || access.write;
     }
+}
 
-    // 2. Should be highest @inner loop
-    if (!(is(LoopType::Inner) || is(LoopType::Inner, LoopType::Inner))) {
-        return false;
+// Write->read, read->write and write->write of the same variable
+bool hasSharedHazard(const SharedAccesses& before, const SharedAccesses& after) {
+    for (const auto& [var, access] : before) {
+        auto it = after.find(var);
+        if (it != after.end() && (access.write || it->second.write)) {
+            return true;
+        }
     }
-    auto* p = parent;
-    if (!p || p->has(LoopType::Inner)) {
+    return false;
+}
+
+bool isHighestInner(const OklLoopInfo& loop) {
+    if (!(loop.is(LoopType::Inner) || loop.is(LoopType::Inner, LoopType::Inner))) {
         return false;
     }
+    return loop.parent && !loop.parent->has(LoopType::Inner);
+}
+
+// Accesses of the sibling loops and of statements between them are accumulated until the first
+// syncronization after them
+bool hasSharedHazardAfter(const OklLoopInfo& loop) {
+    const auto& siblings = loop.parent->children;
+    const auto& between = loop.parent->sharedAccessesBetween;
+    const SharedAccesses none;
+    auto getBetween = [&](size_t idx) -> const SharedAccesses& {
+        return idx < between.size() ? between[idx] : none;
+    };
+
+    SharedAccesses pending = getBetween(0);
+    size_t idx = 0;
+    for (auto it = siblings.begin(); it != siblings.end(); ++it, ++idx) {
+        mergeSharedAccesses(pending, it->sharedAccesses);
+
+        // Statements up to the next loop run after the syncronization
+        auto after = getBetween(idx + 1);
+        if (auto next = std::next(it); next != siblings.end()) {
+            mergeSharedAccesses(after, next->sharedAccesses);
+        } else if (loop.parent->type.back() != LoopType::Outer) {
+            // Next iteration of the parent regular loop can start from any of the loops
+            for (const auto& sibling : siblings) {
+                mergeSharedAccesses(after, sibling.sharedAccesses);
+            }
+            for (const auto& accesses : between) {
+                mergeSharedAccesses(after, accesses);
+            }
+        }
+        auto hazard = hasSharedHazard(pending, after);
 
-    // 3. Should not be the last @inner loop (if parent is Outer)
-    if ((p->type.back() == LoopType::Outer) && &p->children.back() == this) {
+        if (&*it == &loop) {
+            return hazard;
+        }
+        if (hazard && isHighestInner(*it) && !it->sharedInfo.nobarrierApplied) {
+            pending.clear();
+        }
+        mergeSharedAccesses(pending, getBetween(idx + 1));
+    }
+    return false;
+}
+}  // namespace
+
+[[nodiscard]] bool OklLoopInfo::shouldSync() {
+    // 1. Should be highest @inner loop without @nobarrier
+    if (!isHighestInner(*this) || sharedInfo.nobarrierApplied) {
         return false;
     }
 
-    return true;
+    // 2. Should be a hazard between @shared memory accesses before and after the syncronization
+    return hasSharedHazardAfter(*this);
 }
 
-void OklLoopInfo::markSharedUsed() {
-    // Mark this loop and all of its ancestors
-    sharedInfo.used = true;
-    auto* curLoop = parent;
-    while (curLoop) {
-        curLoop->sharedInfo.used = true;
-        curLoop = curLoop->parent;
+[[nodiscard]] bool OklLoopInfo::isSyncElided() {
+    if (!isHighestInner(*this) || sharedInfo.nobarrierApplied || sharedAccesses.empty()) {
+        return false;
     }
+
+    // Last @inner loop is synchronized only for the statements after it (if parent is Outer)
+    if ((parent->type.back() == LoopType::Outer) && &parent->children.back() == this) {
+        return false;
+    }
+
+    return !hasSharedHazardAfter(*this);
 }
 
 void OklLoopInfo::markExclusiveUsed() {
@@ -55,6 +117,14 @@ void OklLoopInfo::markExclusiveUsed() {
     }
 }
 
+void OklLoopInfo::resetGeneratedState() {
+    dynamicShared.reset();
+    localAccessors.clear();
+    sharedPadding.clear();
+    dimIndexBases.clear();
+    staticMemory = {};
+}
+
 [[nodiscard]] bool OklLoopInfo::IsInc() const {
     bool ret = false;
     if (!inc.val) {
@@ -137,6 +207,14 @@ OklLoopInfo* OklLoopInfo::getAttributedParent(std::function<bool(OklLoopInfo&)>
     return ret;
 }
 
+OklLoopInfo* OklLoopInfo::getAttributedRoot() {
+    auto ret = this;
+    while (auto attributedParent = ret->getAttributedParent()) {
+        ret = attributedParent;
+    }
+    return ret;
+}
+
 OklLoopInfo* OklLoopInfo::getFirstAttributedChild() {
     std::deque<OklLoopInfo*> elements = {};
     for (auto& v : children) {
@@ -208,22 +286,20 @@ OklLoopInfo::OptSizes OklLoopInfo::getInnerSizes() {
             ret[static_cast<size_t>(axis[0])] =
                 range.size == 0 ? std::nullopt : std::make_optional(range.size);
         } else if (type.size() == 2) {  // Tiled loop
-            // TODO: maybe reuse attribute parser
-            char* p;
-            auto tileSizeLL = std::strtoll(tileSize.c_str(), &p, 10);
-
             // if tile size is known at compile time, then it is a size of the second loop
             if (type[1] == LoopType::Inner) {
                 ret[static_cast<size_t>(axis[1])] =
-                    *p ? std::nullopt : std::make_optional(static_cast<size_t>(tileSizeLL));
+                    tileSizeValue ? std::make_optional(static_cast<size_t>(*tileSizeValue))
+                                  : std::nullopt;
             }
             // if both tile size and range size are known at compile time, then ceil(range size /
             // tile size) is a size of loop
             if (type[0] == LoopType::Inner) {
-                ret[static_cast<size_t>(axis[0])] = *p || range.size == 0
-                                                        ? std::nullopt
-                                                        : std::make_optional(static_cast<size_t>(
-                                                              1 + ((range.size - 1) / tileSizeLL)));
+                ret[static_cast<size_t>(axis[0])] =
+                    !tileSizeValue || range.size == 0
+                        ? std::nullopt
+                        : std::make_optional(static_cast<size_t>(
+                              1 + ((range.size - 1) / static_cast<size_t>(*tileSizeValue))));
             }
         }
     }
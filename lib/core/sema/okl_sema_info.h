@@ -8,7 +8,10 @@
 #include <clang/AST/Expr.h>
 #include <clang/AST/Type.h>
 
+#include <map>
 #include <optional>
+#include <set>
+#include <vector>
 
 namespace oklt {
 
@@ -41,6 +44,40 @@ struct OklLoopInfo {
         bool nobarrierApplied = false;
     };
 
+    /**
+     * @struct SharedAccess
+     * @brief This structure represents how a @shared variable is accessed in the loop and its
+     * children. Collected for @inner loops, that are not nested into other @inner loops, and their
+     * siblings.
+     */
+    struct SharedAccess {
+        bool read = false;
+        bool write = false;
+    };
+    using SharedAccesses = std::map<const clang::ValueDecl*, SharedAccess>;
+
+    /**
+     * @struct DynamicSharedLayout
+     * @brief This structure represents the layout of @shared variables packed into one dynamic
+     * shared memory buffer. Applied to top-level @outer loops only.
+     */
+    struct DynamicSharedLayout {
+        std::string bytes = "0";  ///< Size of the buffer. Integer literal or runtime expression.
+        size_t align = 16;        ///< Alignment of the buffer.
+        int64_t boundBytes = 0;   ///< Upper bound of the size, that doesn't depend on arguments.
+        std::map<const clang::ParmVarDecl*, int64_t> argBytes;  ///< Bytes per unit of arguments.
+    };
+
+    /**
+     * @struct StaticMemoryUsage
+     * @brief This structure represents the memory of @shared variables per block and @exclusive
+     * variables per thread, that is known at compile time. Applied to top-level @outer loops only.
+     */
+    struct StaticMemoryUsage {
+        size_t sharedBytes = 0;
+        size_t exclusiveBytes = 0;
+    };
+
     using OptSize = std::optional<size_t>;
 
     /**
@@ -83,12 +120,27 @@ struct OklLoopInfo {
     OklLoopInfo* parent = nullptr;
     std::list<OklLoopInfo> children = {};
     std::string tileSize = "";
+    std::optional<int64_t> tileSizeValue;  ///< Tile size folded at compile time.
 
     AttributedTypeInfo sharedInfo;
     AttributedTypeInfo exclusiveInfo;
+    SharedAccesses sharedAccesses;
+    /// Accesses of statements of the body around child loops: before the first one, between each
+    /// two of them and after the last one. Collected for loops with @inner children only.
+    std::vector<SharedAccesses> sharedAccessesBetween;
 
     std::optional<OptSizes> overridenInnerSizes;
     std::optional<int> simdLength;
+    std::optional<ScheduleInfo> schedule;
+    std::optional<DynamicSharedLayout> dynamicShared;
+    std::vector<std::string> localAccessors;
+    std::map<std::string, size_t> sharedPadding;  ///< Padded @shared arrays of top-level @outer.
+    std::optional<CoalescingInfo> coalescing;     ///< Global accesses of top-level @outer.
+    bool fusedWithPrevious = false;  ///< Top-level @outer runs in the kernel of the previous one.
+    std::optional<int> minBlocks;
+    std::optional<int> pipelineStages;
+    std::map<std::string, std::string> dimIndexBases;  ///< Hoisted @dim index bases by expression.
+    StaticMemoryUsage staticMemory;
 
     struct {
         std::string typeName;           ///< Name of type of loop variable.
@@ -113,18 +165,26 @@ struct OklLoopInfo {
     } inc;
 
     /**
-     * @brief Checks if a syncronization after this loop should be performed.
+     * @brief Checks if a syncronization after this loop should be performed, i.e. @shared memory
+     * accessed since the previous syncronization is written before or after by the next loop.
      * @return Boolean indicating whether a syncronization should be performed.
      */
     [[nodiscard]] bool shouldSync();
     /**
-     * @brief Marks that @shared variable is used in this loop or child loops.
+     * @brief Checks if a syncronization after this loop is skipped because there is no @shared
+     * memory hazard, even though the loop uses @shared memory.
+     * @return Boolean indicating whether a syncronization was elided.
      */
-    void markSharedUsed();
+    [[nodiscard]] bool isSyncElided();
     /**
      * @brief   Marks that @exclusive variable is used in this loop or child loops.
      */
     void markExclusiveUsed();
+    /**
+     * @brief Drops the state accumulated by backend handlers during code generation, so the loop
+     * can be transpiled once more.
+     */
+    void resetGeneratedState();
 
     /**
      * @brief Checks if the loop iteration is incremental
@@ -150,6 +210,12 @@ struct OklLoopInfo {
      */
     OklLoopInfo* getAttributedParent(std::function<bool(OklLoopInfo&)> f);
 
+    /**
+     * @brief Retrieves the top-level attributed loop this loop belongs to.
+     * @return Pointer to the top-level attributed loop, this loop if it is top-level itself.
+     */
+    OklLoopInfo* getAttributedRoot();
+
     /**
      * @brief Retrieves the first child loop that has an attribute.
      * @return Pointer to the first child loop that has an attribute.
@@ -257,5 +323,7 @@ struct OklKernelInfo {
     const std::reference_wrapper<const clang::FunctionDecl> decl;  ///< The kernel declaration.
     std::list<OklLoopInfo*> topLevelOuterLoops = {};               ///< The top-level outer loops.
     std::list<OklLoopInfo> topLevelLoops = {};                     ///< The top-level loops.
+    std::set<const clang::ParmVarDecl*> readOnlyParams = {};  ///< Inferred read-only pointers.
+    std::map<const clang::ParmVarDecl*, int64_t> constantParams = {};  ///< Bound at JIT time.
 };
 }  // namespace oklt
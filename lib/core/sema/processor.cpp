@@ -31,6 +31,11 @@ __attribute__((constructor)) void registerOklSemaProcessor() {
         "", preValidateOklForLoopWithoutAttribute, postValidateOklForLoopWithoutAttribute);
 
     assert(ok);
+
+    // sema handler for OKL unroll attribute, unrolled loop stays regular
+    ok = registerSemaHandler(
+        UNROLL_ATTR_NAME, preValidateOklRegularForLoop, postValidateOklRegularForLoop);
+    assert(ok);
 }
 
 }  // namespace
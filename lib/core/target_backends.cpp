@@ -9,6 +9,7 @@ tl::expected<TargetBackend, std::string> backendFromString(const std::string& ty
     static const std::map<std::string, TargetBackend> BACKENDS_MAP = {
         {"serial", TargetBackend::SERIAL},
         {"openmp", TargetBackend::OPENMP},
+        {"threads", TargetBackend::THREADS},
         {"cuda", TargetBackend::CUDA},
         {"hip", TargetBackend::HIP},
         {"dpcpp", TargetBackend::DPCPP},
@@ -28,6 +29,8 @@ std::string backendToString(TargetBackend backend) {
             return std::string{"serial"};
         case TargetBackend::OPENMP:
             return std::string{"openmp"};
+        case TargetBackend::THREADS:
+            return std::string{"threads"};
         case TargetBackend::CUDA:
             return std::string{"cuda"};
         case TargetBackend::HIP:
@@ -44,6 +47,7 @@ bool isHostCategory(TargetBackend backend) {
     switch (backend) {
         case TargetBackend::SERIAL:
         case TargetBackend::OPENMP:
+        case TargetBackend::THREADS:
             return true;
         default:
             return false;
@@ -61,4 +65,15 @@ bool isDeviceCategory(TargetBackend backend) {
     }
 }
 
+size_t getDefaultWavefrontSize(TargetBackend backend) {
+    switch (backend) {
+        case TargetBackend::CUDA:
+            return 32;
+        case TargetBackend::HIP:
+            return 64;
+        default:
+            return 0;
+    }
+}
+
 }  // namespace oklt
@@ -13,10 +13,15 @@ bool AttributedTypeMap::add(const QualType& qt, Attr* attr) {
     }
 
     auto [_, ret] = _attrMap.try_emplace(key, attr);
+    if (ret) {
+        // name is normalized once per attribute instead of once per lookup
+        _attrNames.try_emplace(attr, attr->getNormalizedFullName());
+        _resolved.clear();
+    }
     return ret;
 }
 
-AttrVec AttributedTypeMap::get(clang::ASTContext& ctx, const QualType& qt) {
+AttrVec AttributedTypeMap::resolve(clang::ASTContext& ctx, const QualType& qt) const {
     AttrVec ret = {};
 
     auto cur = qt, par = cur;
@@ -40,32 +45,22 @@ AttrVec AttributedTypeMap::get(clang::ASTContext& ctx, const QualType& qt) {
     return ret;
 }
 
+const AttrVec& AttributedTypeMap::get(clang::ASTContext& ctx, const QualType& qt) {
+    // Qualifiers never change the chain of desugared types, so the sugared type is the key
+    const auto* key = qt.getTypePtrOrNull();
+    auto it = _resolved.find(key);
+    if (it == _resolved.end()) {
+        it = _resolved.try_emplace(key, resolve(ctx, qt)).first;
+    }
+    return it->second;
+}
+
 bool AttributedTypeMap::has(clang::ASTContext& ctx,
                             const QualType& qt,
                             const SmallVector<StringRef>& ids) {
-    auto cur = qt, par = cur;
-    do {
-        const auto* key = cur.getTypePtrOrNull();
-        auto it = _attrMap.find(key);
-        if (it != _attrMap.end()) {
-            auto* attr = it->second;
-            auto isAttrMatch = std::any_of(ids.begin(), ids.end(), [attr](auto name) {
-                return attr->getNormalizedFullName() == name;
-            });
-            if (isAttrMatch) {
-                return true;
-            }
-        }
-
-        par = cur;
-
-        if (auto aqt = dyn_cast_or_null<clang::ArrayType>(par)) {
-            cur = aqt->getElementType();
-            continue;
-        }
-
-        cur = par.getSingleStepDesugaredType(ctx);
-    } while (par != cur);
-
-    return false;
+    const auto& attrs = get(ctx, qt);
+    return std::any_of(attrs.begin(), attrs.end(), [&](const Attr* attr) {
+        StringRef name = _attrNames.lookup(attr);
+        return std::any_of(ids.begin(), ids.end(), [name](auto id) { return name == id; });
+    });
 }
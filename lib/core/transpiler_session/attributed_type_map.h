@@ -3,6 +3,8 @@
 #include <clang/AST/ASTTypeTraits.h>
 #include <llvm/ADT/DenseSet.h>
 
+#include <string>
+
 namespace oklt {
 
 /// Holds a map of nodes and their custom attributes.
@@ -10,18 +12,26 @@ namespace oklt {
 /// This class does not call attribute destructors,
 /// please take care of their proper destruction by calling `ASTContext::addDestruction(Attr)` after
 /// their creation.
+///
+/// Attributes resolved for a type are memoized until the next `add`, since the same few attributed
+/// typedefs are looked up for every reference to a variable of such type.
 class AttributedTypeMap {
    public:
     explicit AttributedTypeMap() = default;
 
     bool add(const clang::QualType& qt, clang::Attr* attr);
-    clang::AttrVec get(clang::ASTContext& ctx, const clang::QualType& qt);
+    /// Returned reference is valid until the next call of `add` or `get`.
+    const clang::AttrVec& get(clang::ASTContext& ctx, const clang::QualType& qt);
     bool has(clang::ASTContext& ctx,
              const clang::QualType& qt,
              const llvm::SmallVector<clang::StringRef>& ids);
 
    private:
+    clang::AttrVec resolve(clang::ASTContext& ctx, const clang::QualType& qt) const;
+
     llvm::DenseMap<const clang::Type*, clang::Attr*> _attrMap;
+    llvm::DenseMap<const clang::Attr*, std::string> _attrNames;
+    llvm::DenseMap<const clang::Type*, clang::AttrVec> _resolved;
 };
 
 }  // namespace oklt
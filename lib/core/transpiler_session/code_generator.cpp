@@ -1,7 +1,9 @@
 #include <oklt/util/io_helper.h>
 
+#include "attributes/attribute_names.h"
 #include "core/transpiler_session/code_generator.h"
 #include "core/transpiler_session/header_info.h"
+#include "core/transpiler_session/kernel_variants.h"
 #include "core/transpiler_session/session_stage.h"
 #include "core/transpiler_session/transpilation_node.h"
 #include "core/transpiler_session/transpiler_session.h"
@@ -10,7 +12,10 @@
 
 #include "core/handler_manager/handler_manager.h"
 
+#include "core/utils/ast_node_parsers.h"
 #include "core/utils/attributes.h"
+#include "core/utils/constant_params.h"
+#include "core/utils/dead_decls.h"
 #include "core/vfs/overlay_fs.h"
 
 #include <clang/AST/Attr.h>
@@ -18,6 +23,9 @@
 #include <clang/Lex/PreprocessorOptions.h>
 
 #include <spdlog/spdlog.h>
+
+#include <algorithm>
+
 namespace {
 using namespace oklt;
 using namespace clang;
@@ -68,6 +76,131 @@ HandleResult applyTranspilationToNodes(SessionStage& stage, const TranspilationN
     return {};
 }
 
+// Loop sizes depend on values of bound arguments, handlers accumulate state in loops on each pass
+void resetLoops(SessionStage& stage, std::list<OklLoopInfo>& loops, const ConstantParams& params) {
+    for (auto& loop : loops) {
+        evaluateLoopSizes(stage, loop, params);
+        loop.resetGeneratedState();
+        resetLoops(stage, loop.children, params);
+    }
+}
+
+void bindKernels(SessionStage& stage,
+                 const std::map<OklSemaCtx::ParsedKernelInfo*, ConstantParams>& kernels) {
+    for (auto& [ki, params] : kernels) {
+        ki->constantParams = params;
+        resetLoops(stage, ki->topLevelLoops, params);
+    }
+}
+
+// Source range of each kernel: from its attribute to the end of the function, in source order
+std::vector<std::pair<const FunctionDecl*, SourceRange>> getKernelRanges(
+    const TranspilationNodes& nodes) {
+    std::vector<std::pair<const FunctionDecl*, SourceRange>> ranges;
+    for (const auto& tnode : nodes) {
+        const auto* func = tnode.node.get<FunctionDecl>();
+        if (func && tnode.attr && tnode.attr->getNormalizedFullName() == KERNEL_ATTR_NAME) {
+            auto begin = getAttrFullSourceRange(*tnode.attr).getBegin();
+            ranges.emplace_back(func, SourceRange{begin, func->getEndLoc()});
+        }
+    }
+    return ranges;
+}
+
+// Variants are embedded next to the default kernels, so the output needs their dependencies too
+void mergeDeps(HeaderDepsInfo& into, const HeaderDepsInfo& from) {
+    auto appendMissing = [](std::vector<std::string>& to, const std::vector<std::string>& src) {
+        for (const auto& item : src) {
+            if (std::find(to.begin(), to.end(), item) == to.end()) {
+                to.push_back(item);
+            }
+        }
+    };
+    appendMissing(into.backendHeaders, from.backendHeaders);
+    appendMissing(into.backendNss, from.backendNss);
+    into.useOklIntrinsic = into.useOklIntrinsic || from.useOklIntrinsic;
+}
+
+// Transpiles kernels once per point of the tuning grid with its values bound as constants and
+// keeps the generated kernels and their header dependencies, the state of the stage is restored
+// afterwards
+HandleResult generateKernelVariants(SessionStage& stage, const TranspilationNodes& nodes) {
+    const auto& input = stage.getSession().getInput();
+    auto& sema = stage.tryEmplaceUserCtx<OklSemaCtx>();
+    auto& variants = stage.tryEmplaceUserCtx<KernelVariants>();
+    auto& deps = stage.tryEmplaceUserCtx<HeaderDepsInfo>();
+    auto savedDeps = deps;
+    // Diagnostics of variants repeat the ones of the default kernels
+    auto& warnings = stage.getSession().getWarnings();
+    auto nWarnings = warnings.size();
+
+    std::map<OklSemaCtx::ParsedKernelInfo*, ConstantParams> defaultParams;
+    for (const auto& tnode : nodes) {
+        if (tnode.ki) {
+            defaultParams.emplace(tnode.ki, tnode.ki->constantParams);
+        }
+    }
+    auto ranges = getKernelRanges(nodes);
+
+    variants.sources.clear();
+    variants.metadata.clear();
+    variants.deps = {};
+    HandleResult result;
+    for (size_t i = 0; i < input.tuningGrid.size() && result; ++i) {
+        auto values = input.constantArgs;
+        for (const auto& [name, value] : input.tuningGrid[i]) {
+            values[name] = value;
+        }
+
+        std::map<OklSemaCtx::ParsedKernelInfo*, ConstantParams> variantParams;
+        for (const auto& [ki, params] : defaultParams) {
+            variantParams.emplace(ki, bindConstantParams(ki->decl.get(), values));
+        }
+        bindKernels(stage, variantParams);
+        sema.getProgramMetaData().kernels.clear();
+        variants.current = i;
+        stage.resetRewriter();
+
+        result = applyTranspilationToNodes(stage, nodes);
+        if (!result) {
+            break;
+        }
+
+        for (const auto& [func, range] : ranges) {
+            variants.sources[func] += "\n" + stage.getRewriter().getRewrittenText(range);
+        }
+        for (auto& kernel : sema.getProgramMetaData().kernels) {
+            kernel.tuningValues = input.tuningGrid[i];
+            variants.metadata.push_back(std::move(kernel));
+        }
+        mergeDeps(variants.deps, deps);
+        deps = savedDeps;
+    }
+
+    variants.current.reset();
+    warnings.resize(std::min(warnings.size(), nWarnings));
+    bindKernels(stage, defaultParams);
+    sema.getProgramMetaData().kernels.clear();
+    deps = savedDeps;
+    stage.resetRewriter();
+    return result;
+}
+
+// Variants follow the default kernel in the source, so they see the same declarations
+void embedKernelVariants(SessionStage& stage, const TranspilationNodes& nodes) {
+    auto& variants = stage.tryEmplaceUserCtx<KernelVariants>();
+    for (const auto& [func, range] : getKernelRanges(nodes)) {
+        auto it = variants.sources.find(func);
+        if (it != variants.sources.end()) {
+            stage.getRewriter().InsertTextAfterToken(range.getEnd(), it->second);
+        }
+    }
+
+    auto& kernels = stage.tryEmplaceUserCtx<OklSemaCtx>().getProgramMetaData().kernels;
+    kernels.insert(kernels.end(), variants.metadata.begin(), variants.metadata.end());
+    mergeDeps(stage.tryEmplaceUserCtx<HeaderDepsInfo>(), variants.deps);
+}
+
 // remove system header to avoid insertion of them during fusion of final transpiled kernel
 void removeSystemHeaders(SessionStage& stage, const HeaderDepsInfo& deps) {
     auto& rewriter = stage.getRewriter();
@@ -145,6 +278,7 @@ tl::expected<std::string, Error> preprocessedInputs(SessionStage& stage,
 
 std::string restoreSystemAndBackendHeaders(
     TargetBackend backend,
+    size_t wavefrontSize,
     std::string& input,
     const HeaderDepsInfo& deps)
 {
@@ -153,8 +287,17 @@ std::string restoreSystemAndBackendHeaders(
         input.insert(0, *it);
     }
 
+    auto runtimeHeaders = embedBackendRuntime(input, backend);
+    for (auto it = runtimeHeaders.rbegin(); it < runtimeHeaders.rend(); ++it) {
+        input.insert(0, "#include <" + *it + ">\n");
+    }
+
     if(deps.useOklIntrinsic) {
         auto intrinsicHeaders = embedInstrinsic(input, backend);
+        // Default width of HIP shuffle intrinsics
+        if (backend == TargetBackend::HIP) {
+            input.insert(0, "#define OKL_WAVEFRONT_SIZE " + std::to_string(wavefrontSize) + "\n");
+        }
 
         for (auto it = intrinsicHeaders.rbegin(); it < intrinsicHeaders.rend(); ++it) {
             input.insert(0, "#include <" + *it + ">\n");
@@ -187,6 +330,7 @@ tl::expected<std::string, Error> fuseIncludeDeps(SessionStage& stage, const Head
     }
 
     auto finalTranspiledKernel = restoreSystemAndBackendHeaders(stage.getBackend(),
+                                                                stage.getWavefrontSize(),
                                                                 preprocessedResult.value(),
                                                                 deps);
     return finalTranspiledKernel;
@@ -196,10 +340,30 @@ tl::expected<std::string, Error> fuseIncludeDeps(SessionStage& stage, const Head
 namespace oklt {
 tl::expected<std::string, Error> generateTranspiledCode(SessionStage& stage) {
     const auto& nodes = stage.tryEmplaceUserCtx<TranspilationNodes>();
+    auto hasVariants = isDeviceCategory(stage.getBackend()) &&
+                       !stage.getSession().getInput().tuningGrid.empty();
+    if (hasVariants) {
+        auto variants = generateKernelVariants(stage, nodes);
+        if (!variants) {
+            return tl::make_unexpected(std::move(variants.error()));
+        }
+    }
+
     auto result = applyTranspilationToNodes(stage, nodes);
     if (!result) {
         return tl::make_unexpected(std::move(result.error()));
     }
+    if (hasVariants) {
+        embedKernelVariants(stage, nodes);
+    }
+
+    if (stage.getSession().getInput().eliminateDeadDecls) {
+        std::vector<const FunctionDecl*> kernels;
+        for (const auto& [func, range] : getKernelRanges(nodes)) {
+            kernels.push_back(func);
+        }
+        eliminateDeadDecls(stage, kernels);
+    }
 
     const auto& deps = stage.tryEmplaceUserCtx<HeaderDepsInfo>();
     auto finalResult = fuseIncludeDeps(stage, deps);
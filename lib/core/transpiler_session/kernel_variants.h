@@ -0,0 +1,28 @@
+#pragma once
+
+#include <oklt/core/kernel_metadata.h>
+
+#include "core/transpiler_session/header_info.h"
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace clang {
+class FunctionDecl;
+}  // namespace clang
+
+namespace oklt {
+/**
+ * @brief Kernels specialized for points of `UserInput::tuningGrid`. Generated by extra code
+ * generation passes over the same AST before the default one and appended to its output.
+ */
+struct KernelVariants {
+    std::optional<size_t> current;  ///< Index of the variant being generated.
+    std::map<const clang::FunctionDecl*, std::string> sources;  ///< Source of all variants.
+    std::vector<KernelInfo> metadata;                           ///< Kernels of all variants.
+    HeaderDepsInfo deps;  ///< Backend headers and intrinsics required by any variant.
+};
+
+}  // namespace oklt
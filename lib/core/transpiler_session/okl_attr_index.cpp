@@ -0,0 +1,62 @@
+#include "core/transpiler_session/okl_attr_index.h"
+#include "core/transpiler_session/session_stage.h"
+
+#include <clang/AST/Decl.h>
+#include <clang/Basic/SourceManager.h>
+#include <clang/Sema/Sema.h>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+// Attributed types of parameters and locals are visible only in their function
+bool isLocal(const Decl& decl) {
+    return isa<FunctionDecl, ParmVarDecl>(decl) || decl.getParentFunctionOrMethod();
+}
+}  // namespace
+
+void OklAttrIndex::add(const SourceManager& sm, const Decl* decl, SourceLocation loc) {
+    auto expansionLoc = sm.getExpansionLoc(loc);
+    auto [fid, offset] = sm.getDecomposedLoc(expansionLoc);
+    _offsets[fid].insert(offset);
+
+    if (decl && !isLocal(*decl) &&
+        (_firstNonLocalDecl.isInvalid() ||
+         sm.isBeforeInTranslationUnit(expansionLoc, _firstNonLocalDecl))) {
+        _firstNonLocalDecl = expansionLoc;
+    }
+}
+
+bool OklAttrIndex::mayContainOkl(const SourceManager& sm, SourceRange range) const {
+    if (_offsets.empty() || range.isInvalid()) {
+        return true;
+    }
+
+    auto begin = sm.getExpansionLoc(range.getBegin());
+    auto end = sm.getExpansionLoc(range.getEnd());
+    if (_firstNonLocalDecl.isValid() && !sm.isBeforeInTranslationUnit(end, _firstNonLocalDecl)) {
+        return true;
+    }
+
+    auto [beginFid, beginOffset] = sm.getDecomposedLoc(begin);
+    auto [endFid, endOffset] = sm.getDecomposedLoc(end);
+    if (beginFid != endFid) {
+        return true;
+    }
+    auto it = _offsets.find(beginFid);
+    if (it == _offsets.end()) {
+        return false;
+    }
+    auto offset = it->second.lower_bound(beginOffset);
+    return offset != it->second.end() && *offset <= endOffset;
+}
+
+void indexOklAttr(Sema& sema, const Decl* decl, SourceLocation loc) {
+    auto* stage = getStageFromASTContext(sema.getASTContext());
+    if (!stage) {
+        return;
+    }
+    stage->tryEmplaceUserCtx<OklAttrIndex>().add(sema.getSourceManager(), decl, loc);
+}
+
+}  // namespace oklt
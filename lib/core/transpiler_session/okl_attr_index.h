@@ -0,0 +1,46 @@
+#pragma once
+
+#include <clang/Basic/SourceLocation.h>
+
+#include <map>
+#include <set>
+
+namespace clang {
+class Decl;
+class Sema;
+class SourceManager;
+}  // namespace clang
+
+namespace oklt {
+
+/// Holds locations of OKL attributes, recorded by the frontend while parsing, and of local
+/// classes, which are handled by backends implicitly.
+///
+/// AST traversal uses it to skip bodies of functions, that can't contain OKL constructs, so its
+/// cost scales with the size of kernels rather than the size of included user headers.
+class OklAttrIndex {
+   public:
+    explicit OklAttrIndex() = default;
+
+    void add(const clang::SourceManager& sm, const clang::Decl* decl, clang::SourceLocation loc);
+
+    /**
+     * @brief Checks if the source range may contain OKL constructs: an OKL attribute is located
+     * inside it, or it follows a non-local declaration with an OKL attribute, whose attributed
+     * type can be used there. Conservatively true if nothing was recorded.
+     */
+    [[nodiscard]] bool mayContainOkl(const clang::SourceManager& sm,
+                                     clang::SourceRange range) const;
+
+   private:
+    std::map<clang::FileID, std::set<unsigned>> _offsets;
+    clang::SourceLocation _firstNonLocalDecl;
+};
+
+/**
+ * @brief Records the OKL attribute applied to the declaration or, if `decl` is null, to a
+ * statement in the index of the session stage being parsed.
+ */
+void indexOklAttr(clang::Sema& sema, const clang::Decl* decl, clang::SourceLocation loc);
+
+}  // namespace oklt
@@ -10,6 +10,8 @@ struct Error;
 using TranspilerSessionResult = tl::expected<SharedTranspilerSession, std::vector<Error>>;
 
 inline UserResult toUserResult(SharedTranspilerSession& session) {
-    return std::move(session->getOutput());
+    auto output = std::move(session->getOutput());
+    output.warnings = session->getWarnings();
+    return output;
 }
 }  // namespace oklt
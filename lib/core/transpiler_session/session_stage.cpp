@@ -32,9 +32,13 @@ HandlerManager& SessionStage::getAttrManager() {
 }
 
 void SessionStage::setLauncherMode() {
+    resetRewriter();
+    _backend = TargetBackend::_LAUNCHER;
+}
+
+void SessionStage::resetRewriter() {
     _rewriter =
         std::make_unique<oklt::Rewriter>(_compiler.getSourceManager(), _compiler.getLangOpts());
-    _backend = TargetBackend::_LAUNCHER;
 }
 
 std::string SessionStage::getRewriterResultForMainFile() {
@@ -96,6 +100,11 @@ TargetBackend SessionStage::getBackend() const {
     return _backend;
 }
 
+size_t SessionStage::getWavefrontSize() const {
+    auto size = _session.getInput().wavefrontSize;
+    return size ? size : getDefaultWavefrontSize(_backend);
+}
+
 void SessionStage::pushDiagnosticMessage(clang::StoredDiagnostic& message) {
     _session.pushDiagnosticMessage(message, *this);
 }
@@ -129,6 +138,19 @@ void SessionStage::pushWarning(std::string desc) {
     _session.pushWarning(std::move(desc));
 }
 
+void SessionStage::pushWarning(std::string desc, clang::SourceLocation loc) {
+    auto& sm = getCompiler().getSourceManager();
+    StoredDiagnostic sd(
+        DiagnosticsEngine::Level::Warning, 0, desc, FullSourceLoc(loc, sm), {}, {});
+    _session.pushDiagnosticMessage(sd, *this);
+}
+
+void SessionStage::pushNote(std::string desc, clang::SourceLocation loc) {
+    auto& sm = getCompiler().getSourceManager();
+    StoredDiagnostic sd(DiagnosticsEngine::Level::Note, 0, desc, FullSourceLoc(loc, sm), {}, {});
+    _session.pushDiagnosticMessage(sd, *this);
+}
+
 SessionStage* getStageFromASTContext(clang::ASTContext& ast) {
     // NOTE:
     // There are a few stable references/pointer that can point to our controlled classes and
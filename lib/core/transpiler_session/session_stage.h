@@ -94,6 +94,13 @@ class SessionStage {
      */
     [[nodiscard]] TargetBackend getBackend() const;
 
+    /**
+     * @brief Gets the number of threads in warp/wavefront that the code is generated for.
+     *
+     * @return size_t User provided size or default of the target backend.
+     */
+    [[nodiscard]] size_t getWavefrontSize() const;
+
     /**
      * @brief Gets the attribute manager.
      *
@@ -106,6 +113,11 @@ class SessionStage {
      */
     void setLauncherMode();
 
+    /**
+     * @brief Drops all rewrites done so far by replacing the rewriter with a fresh one.
+     */
+    void resetRewriter();
+
     /**
      * @brief Save a diagnostic message.
      *
@@ -135,6 +147,22 @@ class SessionStage {
      */
     void pushWarning(std::string desc);
 
+    /**
+     * @brief Add warning, that refers to the source location.
+     *
+     * @param desc The warning description.
+     * @param loc The source location the warning refers to.
+     */
+    void pushWarning(std::string desc, clang::SourceLocation loc);
+
+    /**
+     * @brief Add note, e.g. to explain an optimization decision.
+     *
+     * @param desc The note description.
+     * @param loc The source location the note refers to.
+     */
+    void pushNote(std::string desc, clang::SourceLocation loc);
+
     /**
      * @brief Checks if a user context exists.
      *
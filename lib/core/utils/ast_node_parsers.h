@@ -2,6 +2,7 @@
 
 #include <oklt/core/kernel_metadata.h>
 #include "core/sema/okl_sema_info.h"
+#include "core/utils/constant_params.h"
 
 #include <tl/expected.hpp>
 
@@ -18,4 +19,13 @@ class SessionStage;
 tl::expected<OklLoopInfo, Error> parseForStmt(SessionStage& stage,
                                               const clang::ForStmt& s,
                                               const clang::Attr* a);
+
+/**
+ * @brief (Re)computes range size and tile size of the parsed loop, folding bound kernel
+ * parameters into its bounds.
+ * @param stage The session stage.
+ * @param loop The parsed loop.
+ * @param params The bound kernel parameters.
+ */
+void evaluateLoopSizes(SessionStage& stage, OklLoopInfo& loop, const ConstantParams& params);
 }  // namespace oklt
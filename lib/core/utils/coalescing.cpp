@@ -0,0 +1,447 @@
+#include "attributes/attribute_names.h"
+#include "attributes/frontend/params/dim.h"
+#include "core/handler_manager/handler_manager.h"
+#include "core/transpiler_session/attributed_type_map.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/coalescing.h"
+
+#include <clang/AST/AST.h>
+#include <clang/AST/ParentMapContext.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <map>
+#include <numeric>
+#include <set>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+// Local variables are followed through their initializers up to this depth
+const size_t MAX_INIT_DEPTH = 8;
+
+// Difference of the index between consecutive threads along x axis
+struct XStride {
+    enum class Kind { Affine, Runtime, Scattered };
+    Kind kind = Kind::Affine;
+    int64_t value = 0;  ///< Stride of the affine index.
+
+    [[nodiscard]] bool isInvariant() const { return kind == Kind::Affine && value == 0; }
+};
+
+const XStride INVARIANT = {};
+const XStride RUNTIME = {XStride::Kind::Runtime, 0};
+const XStride SCATTERED = {XStride::Kind::Scattered, 0};
+
+XStride add(const XStride& lhs, const XStride& rhs) {
+    if (lhs.kind == XStride::Kind::Scattered || rhs.kind == XStride::Kind::Scattered) {
+        return SCATTERED;
+    }
+    if (lhs.kind == XStride::Kind::Runtime || rhs.kind == XStride::Kind::Runtime) {
+        return RUNTIME;
+    }
+    return {XStride::Kind::Affine, lhs.value + rhs.value};
+}
+
+// Factor is nullopt if it isn't known at compile time
+XStride scale(const XStride& stride, std::optional<int64_t> factor) {
+    if (stride.isInvariant() || (factor && *factor == 0)) {
+        return INVARIANT;
+    }
+    if (stride.kind != XStride::Kind::Affine) {
+        return stride;
+    }
+    if (!factor) {
+        return RUNTIME;
+    }
+    return {XStride::Kind::Affine, stride.value * *factor};
+}
+
+std::optional<int64_t> parseDim(const std::string& dim) {
+    if (dim.empty() || !std::all_of(dim.begin(), dim.end(), ::isdigit)) {
+        return std::nullopt;
+    }
+    return std::stoll(dim);
+}
+
+// Writes of local variables after their declaration, i.e. assignments, increments and taken
+// addresses. Increment of the `for` loop, that declares the variable, is recorded as its step
+class LocalWritesCollector : public RecursiveASTVisitor<LocalWritesCollector> {
+   public:
+    bool TraverseForStmt(ForStmt* stmt) {
+        const VarDecl* var = nullptr;
+        const auto* decl = dyn_cast_or_null<DeclStmt>(stmt->getInit());
+        if (decl && decl->isSingleDecl()) {
+            var = dyn_cast<VarDecl>(decl->getSingleDecl());
+        }
+
+        TraverseStmt(stmt->getInit());
+        TraverseStmt(stmt->getCond());
+        TraverseStmt(stmt->getBody());
+        if (var && stmt->getInc()) {
+            steps[var] = stmt->getInc();
+            _loopVar = var;
+        }
+        TraverseStmt(stmt->getInc());
+        _loopVar = nullptr;
+        return true;
+    }
+
+    bool VisitBinaryOperator(BinaryOperator* op) {
+        if (op->isAssignmentOp()) {
+            add(*op->getLHS());
+        }
+        return true;
+    }
+
+    bool VisitUnaryOperator(UnaryOperator* op) {
+        if (op->isIncrementDecrementOp() || op->getOpcode() == UO_AddrOf) {
+            add(*op->getSubExpr());
+        }
+        return true;
+    }
+
+    std::set<const VarDecl*> written;
+    std::map<const VarDecl*, const Expr*> steps;
+
+   private:
+    void add(const Expr& expr) {
+        const auto* ref = dyn_cast<DeclRefExpr>(expr.IgnoreParenImpCasts());
+        const auto* var = ref ? dyn_cast<VarDecl>(ref->getDecl()) : nullptr;
+        if (var && var != _loopVar) {
+            written.insert(var);
+        }
+    }
+
+    const VarDecl* _loopVar = nullptr;
+};
+
+class StrideAnalyzer {
+   public:
+    StrideAnalyzer(ASTContext& ctx, const std::set<const ValueDecl*>& xVars)
+        : _ctx(ctx),
+          _xVars(xVars) {}
+
+    XStride get(const Expr& expr, size_t depth = 0) {
+        const auto* e = expr.IgnoreParenImpCasts();
+        if (evaluate(*e)) {
+            return INVARIANT;
+        }
+
+        if (const auto* ref = dyn_cast<DeclRefExpr>(e)) {
+            if (_xVars.count(ref->getDecl())) {
+                return {XStride::Kind::Affine, 1};
+            }
+            // Index is usually computed into a local variable, e.g. `int idx = x + y * n;`
+            const auto* var = dyn_cast<VarDecl>(ref->getDecl());
+            if (var && !isa<ParmVarDecl>(var) && var->hasLocalStorage()) {
+                return getLocal(*var, depth);
+            }
+            return INVARIANT;
+        }
+
+        if (const auto* cast = dyn_cast<ExplicitCastExpr>(e)) {
+            if (cast->getType()->isIntegerType() &&
+                cast->getSubExpr()->getType()->isIntegerType()) {
+                return get(*cast->getSubExpr(), depth);
+            }
+        }
+
+        if (const auto* unOp = dyn_cast<UnaryOperator>(e)) {
+            if (unOp->getOpcode() == UO_Plus) {
+                return get(*unOp->getSubExpr(), depth);
+            }
+            if (unOp->getOpcode() == UO_Minus) {
+                return scale(get(*unOp->getSubExpr(), depth), -1);
+            }
+        }
+
+        if (const auto* binOp = dyn_cast<BinaryOperator>(e)) {
+            const auto& lhs = *binOp->getLHS();
+            const auto& rhs = *binOp->getRHS();
+            switch (binOp->getOpcode()) {
+                case BO_Add:
+                    return add(get(lhs, depth), get(rhs, depth));
+                case BO_Sub:
+                    return add(get(lhs, depth), scale(get(rhs, depth), -1));
+                case BO_Mul: {
+                    auto lhsStride = get(lhs, depth);
+                    auto rhsStride = get(rhs, depth);
+                    if (lhsStride.isInvariant()) {
+                        return scale(rhsStride, evaluate(lhs));
+                    }
+                    if (rhsStride.isInvariant()) {
+                        return scale(lhsStride, evaluate(rhs));
+                    }
+                    return SCATTERED;
+                }
+                case BO_Shl: {
+                    auto shift = evaluate(rhs);
+                    if (shift && *shift >= 0 && *shift < 32) {
+                        return scale(get(lhs, depth), int64_t(1) << *shift);
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+
+        // Any other use of x axis variables, e.g. division, load of an index or a call
+        for (const auto* child : e->children()) {
+            const auto* childExpr = dyn_cast_or_null<Expr>(child);
+            if (childExpr && !get(*childExpr, depth).isInvariant()) {
+                return SCATTERED;
+            }
+        }
+        return INVARIANT;
+    }
+
+   private:
+    // Value of a local variable is known only if it is set once by its initializer. Iteration
+    // variable of a `for` loop keeps the stride of its initializer, if the step is the same for
+    // all threads
+    XStride getLocal(const VarDecl& var, size_t depth) {
+        const auto& writes = getWrites(var);
+        if (!var.getInit() || depth >= MAX_INIT_DEPTH || writes.written.count(&var)) {
+            return SCATTERED;
+        }
+
+        auto it = writes.steps.find(&var);
+        if (it != writes.steps.end()) {
+            const auto* step = it->second->IgnoreParenImpCasts();
+            if (const auto* assign = dyn_cast<CompoundAssignOperator>(step)) {
+                bool isAdditive = assign->getOpcode() == BO_AddAssign ||
+                                  assign->getOpcode() == BO_SubAssign;
+                if (!isAdditive || !get(*assign->getRHS(), depth + 1).isInvariant()) {
+                    return SCATTERED;
+                }
+            } else if (!isa<UnaryOperator>(step)) {
+                return SCATTERED;
+            }
+        }
+        return get(*var.getInit(), depth + 1);
+    }
+
+    const LocalWritesCollector& getWrites(const VarDecl& var) {
+        const auto* func = dyn_cast_or_null<FunctionDecl>(var.getParentFunctionOrMethod());
+        auto [it, inserted] = _writes.try_emplace(func);
+        if (inserted && func && func->getBody()) {
+            it->second.TraverseStmt(func->getBody());
+        }
+        return it->second;
+    }
+
+    std::optional<int64_t> evaluate(const Expr& e) {
+        Expr::EvalResult result;
+        if (e.isValueDependent() || !e.EvaluateAsInt(result, _ctx)) {
+            return std::nullopt;
+        }
+        return result.Val.getInt().getExtValue();
+    }
+
+    ASTContext& _ctx;
+    const std::set<const ValueDecl*>& _xVars;
+    std::map<const FunctionDecl*, LocalWritesCollector> _writes;
+};
+
+class GlobalAccessVisitor : public RecursiveASTVisitor<GlobalAccessVisitor> {
+   public:
+    GlobalAccessVisitor(SessionStage& stage,
+                        const std::set<const ValueDecl*>& xVars,
+                        CoalescingInfo& summary)
+        : _stage(stage),
+          _ctx(stage.getCompiler().getASTContext()),
+          _attrTypeMap(stage.tryEmplaceUserCtx<AttributedTypeMap>()),
+          _analyzer(_ctx, xVars),
+          _summary(summary) {}
+
+    bool VisitDeclRefExpr(DeclRefExpr* ref) {
+        const auto* param = dyn_cast<ParmVarDecl>(ref->getDecl());
+        if (!param || !ref->getType()->isPointerType()) {
+            return true;
+        }
+
+        std::optional<XStride> stride;
+        if (_attrTypeMap.has(_ctx, ref->getType(), {DIM_ATTR_NAME})) {
+            stride = getDimAccessStride(*ref);
+        }
+        if (!stride) {
+            stride = getSubscriptStride(*ref);
+        }
+        if (stride) {
+            report(*ref, *stride);
+        }
+        return true;
+    }
+
+   private:
+    const Expr* getParent(const Expr& expr) {
+        const Expr* current = &expr;
+        for (;;) {
+            auto parents = _ctx.getParents(*current);
+            if (parents.size() != 1) {
+                return nullptr;
+            }
+            const auto* parent = parents[0].get<Expr>();
+            if (!parent || !isa<ParenExpr, ImplicitCastExpr>(parent)) {
+                return parent;
+            }
+            current = parent;
+        }
+    }
+
+    // `p[i]` or `p[i][j]`, the last subscript is contiguous in memory
+    std::optional<XStride> getSubscriptStride(const DeclRefExpr& ref) {
+        std::vector<const Expr*> subscripts;
+        const Expr* current = &ref;
+        while (const auto* subscript = dyn_cast_or_null<ArraySubscriptExpr>(getParent(*current))) {
+            if (subscript->getBase()->IgnoreParenImpCasts() != current) {
+                break;
+            }
+            subscripts.push_back(subscript->getIdx());
+            current = subscript;
+        }
+        if (subscripts.empty()) {
+            return std::nullopt;
+        }
+
+        auto stride = _analyzer.get(*subscripts.back());
+        for (auto it = subscripts.begin(); it + 1 != subscripts.end(); ++it) {
+            stride = add(stride, scale(_analyzer.get(**it), std::nullopt));
+        }
+        return stride;
+    }
+
+    // `p(i, j)` is `p[i + N * j]` or reordered by @dimOrder
+    std::optional<XStride> getDimAccessStride(const DeclRefExpr& ref) {
+        std::vector<const Expr*> args;
+        const auto* parent = getParent(ref);
+        if (const auto* rec = dyn_cast_or_null<RecoveryExpr>(parent)) {
+            auto subExprs = rec->subExpressions();
+            if (subExprs.empty() || subExprs.front()->IgnoreParenImpCasts() != &ref) {
+                return std::nullopt;
+            }
+            args.assign(subExprs.begin() + 1, subExprs.end());
+        } else if (const auto* call = dyn_cast_or_null<CallExpr>(parent)) {
+            if (call->getCallee()->IgnoreParenImpCasts() != &ref) {
+                return std::nullopt;
+            }
+            args.assign(call->arg_begin(), call->arg_end());
+        } else {
+            return std::nullopt;
+        }
+
+        std::vector<std::string> dims;
+        std::vector<size_t> order;
+        auto& am = _stage.getAttrManager();
+        for (const auto* attr : _attrTypeMap.get(_ctx, ref.getType())) {
+            auto name = attr ? attr->getNormalizedFullName() : std::string();
+            if (name != DIM_ATTR_NAME && name != DIM_ORDER_ATTR_NAME) {
+                continue;
+            }
+            auto params = am.parseAttr(_stage, *attr);
+            if (!params) {
+                return std::nullopt;
+            }
+            if (const auto* dim = std::any_cast<AttributedDim>(&params.value())) {
+                dims = dim->dim;
+            } else if (const auto* dimOrder = std::any_cast<AttributedDimOrder>(&params.value())) {
+                order = dimOrder->idx;
+            }
+        }
+        if (order.empty()) {
+            order.resize(dims.size());
+            std::iota(order.begin(), order.end(), 0);
+        }
+        if (dims.empty() || args.size() != dims.size() || order.size() != dims.size() ||
+            std::any_of(order.begin(), order.end(), [&](size_t i) { return i >= dims.size(); })) {
+            return std::nullopt;
+        }
+
+        auto stride = INVARIANT;
+        std::optional<int64_t> multiplier = 1;
+        for (auto idx : order) {
+            stride = add(stride, scale(_analyzer.get(*args[idx]), multiplier));
+            auto dim = parseDim(dims[idx]);
+            multiplier = multiplier && dim ? std::optional<int64_t>(*multiplier * *dim)
+                                           : std::nullopt;
+        }
+        return stride;
+    }
+
+    void report(const DeclRefExpr& ref, const XStride& stride) {
+        auto name = ref.getDecl()->getNameAsString();
+        switch (stride.kind) {
+            case XStride::Kind::Affine:
+                if (stride.value >= -1 && stride.value <= 1) {
+                    ++_summary.coalesced;
+                    return;
+                }
+                ++_summary.strided;
+                _stage.pushWarning("[@inner] strided access to global memory '" + name +
+                                       "': consecutive threads along x axis access elements " +
+                                       std::to_string(std::abs(stride.value)) + " apart",
+                                   ref.getBeginLoc());
+                return;
+            case XStride::Kind::Runtime:
+                ++_summary.strided;
+                _stage.pushWarning("[@inner] strided access to global memory '" + name +
+                                       "': consecutive threads along x axis access elements a "
+                                       "runtime stride apart",
+                                   ref.getBeginLoc());
+                return;
+            case XStride::Kind::Scattered:
+                ++_summary.scattered;
+                _stage.pushWarning("[@inner] scattered access to global memory '" + name +
+                                       "': index is not an affine function of x axis iteration "
+                                       "variables",
+                                   ref.getBeginLoc());
+                return;
+        }
+    }
+
+    SessionStage& _stage;
+    ASTContext& _ctx;
+    AttributedTypeMap& _attrTypeMap;
+    StrideAnalyzer _analyzer;
+    CoalescingInfo& _summary;
+};
+
+// Iteration variables of @inner loops along x axis, consecutive threads differ by them
+void collectThreadXVars(const OklLoopInfo& loop, std::set<const ValueDecl*>& vars) {
+    for (size_t i = 0; i < loop.type.size() && i < loop.axis.size(); ++i) {
+        if (loop.type[i] == LoopType::Inner && loop.axis[i] == Axis::X && loop.var.varDecl) {
+            vars.insert(loop.var.varDecl);
+        }
+    }
+    for (const auto& child : loop.children) {
+        collectThreadXVars(child, vars);
+    }
+}
+
+// Only the highest @inner loops are traversed, so that nested ones are not visited twice
+void traverseInnerLoops(OklLoopInfo& loop, GlobalAccessVisitor& visitor) {
+    if (loop.has(LoopType::Inner)) {
+        visitor.TraverseStmt(const_cast<ForStmt*>(&loop.stmt));
+        return;
+    }
+    for (auto& child : loop.children) {
+        traverseInnerLoops(child, visitor);
+    }
+}
+}  // namespace
+
+void analyzeCoalescing(SessionStage& stage, OklLoopInfo& outer) {
+    std::set<const ValueDecl*> xVars;
+    collectThreadXVars(outer, xVars);
+
+    auto& summary = outer.coalescing.emplace();
+    GlobalAccessVisitor visitor(stage, xVars, summary);
+    traverseInnerLoops(outer, visitor);
+}
+
+}  // namespace oklt
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "core/sema/okl_sema_info.h"
+
+namespace oklt {
+
+class SessionStage;
+
+/**
+ * @brief Classifies accesses to global memory, i.e. subscripts and @dim accesses of kernel pointer
+ * parameters, inside @inner loops of the top-level @outer loop by addresses of consecutive threads
+ * along x axis: coalesced (the same or consecutive elements), strided (elements of constant or
+ * runtime stride apart) or scattered (index is not an affine function of x axis iteration
+ * variables, or depends on a local variable without initializer or assigned later). Every strided
+ * and scattered access is reported as a warning.
+ * @param stage The session stage.
+ * @param outer The top-level @outer loop, receives the summary.
+ */
+void analyzeCoalescing(SessionStage& stage, OklLoopInfo& outer);
+
+}  // namespace oklt
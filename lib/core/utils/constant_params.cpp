@@ -0,0 +1,129 @@
+#include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
+#include "core/utils/constant_params.h"
+
+#include <clang/AST/AST.h>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+// Value is substituted for every use, so the argument must never change
+bool isBindable(const ParmVarDecl& param) {
+    auto type = param.getType();
+    return !type->isDependentType() && type.isConstQualified() && type->isIntegerType();
+}
+
+// Bounds recursion through initializers of constants, that refer to each other
+const size_t MAX_EVALUATION_DEPTH = 16;
+
+std::optional<int64_t> evaluate(const Expr& expr,
+                                const ASTContext& ctx,
+                                const ConstantParams& params,
+                                size_t depth) {
+    if (depth > MAX_EVALUATION_DEPTH) {
+        return std::nullopt;
+    }
+    const auto* e = expr.IgnoreParenImpCasts();
+    Expr::EvalResult result;
+    if (!e->isValueDependent() && !e->containsErrors() &&
+        e->EvaluateAsInt(result, ctx, Expr::SE_AllowSideEffects)) {
+        return result.Val.getInt().getExtValue();
+    }
+
+    if (const auto* ref = dyn_cast<DeclRefExpr>(e)) {
+        if (const auto* param = dyn_cast<ParmVarDecl>(ref->getDecl())) {
+            auto it = params.find(param);
+            return it != params.end() ? std::make_optional(it->second) : std::nullopt;
+        }
+        // Constant, that is initialized by arithmetic of bound parameters
+        const auto* var = dyn_cast<VarDecl>(ref->getDecl());
+        if (var && var->getType().isConstQualified() && var->getType()->isIntegerType() &&
+            var->getInit()) {
+            return evaluate(*var->getInit(), ctx, params, depth + 1);
+        }
+        return std::nullopt;
+    }
+
+    if (const auto* unOp = dyn_cast<UnaryOperator>(e)) {
+        auto value = evaluate(*unOp->getSubExpr(), ctx, params, depth + 1);
+        if (!value) {
+            return std::nullopt;
+        }
+        switch (unOp->getOpcode()) {
+            case UO_Plus:
+                return value;
+            case UO_Minus:
+                return -*value;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    if (const auto* binOp = dyn_cast<BinaryOperator>(e)) {
+        auto lhs = evaluate(*binOp->getLHS(), ctx, params, depth + 1);
+        auto rhs = evaluate(*binOp->getRHS(), ctx, params, depth + 1);
+        if (!lhs || !rhs) {
+            return std::nullopt;
+        }
+        switch (binOp->getOpcode()) {
+            case BO_Add:
+                return *lhs + *rhs;
+            case BO_Sub:
+                return *lhs - *rhs;
+            case BO_Mul:
+                return *lhs * *rhs;
+            case BO_Div:
+                return *rhs ? std::make_optional(*lhs / *rhs) : std::nullopt;
+            case BO_Rem:
+                return *rhs ? std::make_optional(*lhs % *rhs) : std::nullopt;
+            case BO_Shl:
+                return *rhs >= 0 && *rhs < 63 ? std::make_optional(*lhs << *rhs) : std::nullopt;
+            case BO_Shr:
+                return *rhs >= 0 && *rhs < 63 ? std::make_optional(*lhs >> *rhs) : std::nullopt;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    return std::nullopt;
+}
+}  // namespace
+
+ConstantParams collectConstantParams(SessionStage& stage, const FunctionDecl& func) {
+    const auto& values = stage.getSession().getInput().constantArgs;
+    if (stage.getBackend() != TargetBackend::_LAUNCHER) {
+        for (const auto* param : func.parameters()) {
+            if (param && values.count(param->getNameAsString()) && !isBindable(*param)) {
+                stage.pushWarning("argument '" + param->getNameAsString() +
+                                      "' is not bound to a constant: it must be a const integer",
+                                  param->getLocation());
+            }
+        }
+    }
+    return bindConstantParams(func, values);
+}
+
+ConstantParams bindConstantParams(const FunctionDecl& func,
+                                  const std::map<std::string, int64_t>& values) {
+    if (values.empty()) {
+        return {};
+    }
+
+    ConstantParams params;
+    for (const auto* param : func.parameters()) {
+        auto it = param ? values.find(param->getNameAsString()) : values.end();
+        if (it != values.end() && isBindable(*param)) {
+            params.emplace(param, it->second);
+        }
+    }
+    return params;
+}
+
+std::optional<int64_t> evaluateWithConstantParams(const Expr& expr,
+                                                  const ASTContext& ctx,
+                                                  const ConstantParams& params) {
+    return evaluate(expr, ctx, params, 0);
+}
+
+}  // namespace oklt
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace clang {
+class ASTContext;
+class Expr;
+class FunctionDecl;
+class ParmVarDecl;
+}  // namespace clang
+
+namespace oklt {
+
+class SessionStage;
+
+using ConstantParams = std::map<const clang::ParmVarDecl*, int64_t>;
+
+/**
+ * @brief Binds parameters of the kernel to values of `UserInput::constantArgs` by name. Only
+ * `const` parameters of integer types are bound, every other named parameter is reported as a
+ * warning.
+ * @param stage The session stage.
+ * @param func The kernel function.
+ * @return Bound parameters with their values.
+ */
+ConstantParams collectConstantParams(SessionStage& stage, const clang::FunctionDecl& func);
+
+/**
+ * @brief Binds `const` integer parameters of the kernel to the given values by name, other
+ * parameters are skipped silently.
+ * @param func The kernel function.
+ * @param values Values of parameters by name.
+ * @return Bound parameters with their values.
+ */
+ConstantParams bindConstantParams(const clang::FunctionDecl& func,
+                                  const std::map<std::string, int64_t>& values);
+
+/**
+ * @brief Evaluates integer expression, folding bound kernel parameters into it: integer constant
+ * expression or arithmetic (+, -, *, /, %, <<, >>, unary -) of constants, bound parameters and
+ * `const` integer variables initialized by such arithmetic.
+ * @param expr The expression.
+ * @param ctx The AST context.
+ * @param params The bound kernel parameters.
+ * @return Value of the expression, nullopt if it isn't known at compile time.
+ */
+std::optional<int64_t> evaluateWithConstantParams(const clang::Expr& expr,
+                                                  const clang::ASTContext& ctx,
+                                                  const ConstantParams& params);
+
+}  // namespace oklt
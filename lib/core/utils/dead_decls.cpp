@@ -0,0 +1,428 @@
+#include "attributes/attribute_names.h"
+#include "core/transpiler_session/attributed_type_map.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/attributes.h"
+#include "core/utils/dead_decls.h"
+#include "core/utils/range_to_string.h"
+
+#include <clang/AST/AST.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+#include <clang/Lex/Lexer.h>
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <set>
+#include <string>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+// Tokens scanned for the semicolon, that terminates a declaration
+const size_t MAX_TERMINATOR_TOKENS = 256;
+
+// Top-level declarations, that share source text, e.g. a struct and a variable of its type, are
+// either all emitted or all dropped
+struct DeclGroup {
+    std::vector<const Decl*> decls;
+    SourceRange range;
+    bool isRemovable = true;
+    bool isTraversed = false;
+};
+
+// Declaration, by which the top-level declaration containing `decl` is known in the source:
+// templates are known by their pattern, members by their class, locals by their function
+const Decl* getKey(const Decl* decl) {
+    while (decl && !isa<TranslationUnitDecl>(decl)) {
+        if (const auto* func = dyn_cast<FunctionDecl>(decl)) {
+            if (const auto* pattern = func->getTemplateInstantiationPattern()) {
+                func = pattern;
+            }
+            if (const auto* primary = func->getPrimaryTemplate()) {
+                func = primary->getTemplatedDecl();
+            }
+            decl = func;
+        } else if (const auto* spec = dyn_cast<ClassTemplateSpecializationDecl>(decl)) {
+            decl = spec->getSpecializedTemplate()->getTemplatedDecl();
+        } else if (const auto* record = dyn_cast<CXXRecordDecl>(decl)) {
+            if (const auto* pattern = record->getTemplateInstantiationPattern()) {
+                decl = pattern;
+            }
+        } else if (const auto* var = dyn_cast<VarDecl>(decl)) {
+            if (const auto* pattern = var->getTemplateInstantiationPattern()) {
+                decl = pattern;
+            }
+        }
+        if (const auto* tmpl = dyn_cast<TemplateDecl>(decl)) {
+            if (tmpl->getTemplatedDecl()) {
+                decl = tmpl->getTemplatedDecl();
+            }
+        }
+
+        const auto* ctx = decl->getDeclContext();
+        if (!ctx || ctx->getRedeclContext()->isFileContext()) {
+            break;
+        }
+        decl = dyn_cast<Decl>(ctx);
+    }
+    return decl && !isa<TranslationUnitDecl>(decl) ? decl->getCanonicalDecl() : nullptr;
+}
+
+bool isRemovableKind(const Decl& decl) {
+    if (const auto* spec = dyn_cast<ClassTemplateSpecializationDecl>(&decl)) {
+        return spec->getSpecializationKind() == TSK_ExplicitSpecialization;
+    }
+    return isa<FunctionDecl,
+               FunctionTemplateDecl,
+               VarDecl,
+               TagDecl,
+               TypedefNameDecl,
+               ClassTemplateDecl,
+               TypeAliasTemplateDecl,
+               VarTemplateDecl>(decl);
+}
+
+bool hasKernelAttr(const Decl& decl) {
+    const auto* func = decl.getAsFunction();
+    return func && func->hasAttrs() &&
+           std::any_of(func->attrs().begin(), func->attrs().end(), [](const Attr* attr) {
+               return attr && isOklAttribute(*attr) &&
+                      attr->getNormalizedFullName() == KERNEL_ATTR_NAME;
+           });
+}
+
+// Terminating semicolon of the declaration, if it isn't a definition of a function
+SourceLocation getDeclEnd(const Decl& decl, const SourceManager& sm, const LangOptions& opts) {
+    auto end = decl.getEndLoc();
+    const auto* func = decl.getAsFunction();
+    if (func && func->doesThisDeclarationHaveABody() && !func->isDefaulted() &&
+        !func->isDeleted()) {
+        return end;
+    }
+
+    int depth = 0;
+    for (size_t i = 0; i < MAX_TERMINATOR_TOKENS; ++i) {
+        auto tok = Lexer::findNextToken(end, sm, opts);
+        if (!tok || tok->is(tok::eof)) {
+            return {};
+        }
+        end = tok->getLocation();
+        if (tok->isOneOf(tok::l_paren, tok::l_square, tok::l_brace)) {
+            ++depth;
+        } else if (tok->isOneOf(tok::r_paren, tok::r_square, tok::r_brace)) {
+            --depth;
+        } else if (tok->is(tok::semi) && depth == 0) {
+            return end;
+        }
+    }
+    return {};
+}
+
+class ReachabilityVisitor : public RecursiveASTVisitor<ReachabilityVisitor> {
+   public:
+    ReachabilityVisitor(SessionStage& stage,
+                        std::set<const Decl*>& reachable,
+                        const std::map<std::string, std::vector<const Decl*>>& names)
+        : _ctx(stage.getCompiler().getASTContext()),
+          _attrTypeMap(stage.tryEmplaceUserCtx<AttributedTypeMap>()),
+          _reachable(reachable),
+          _names(names) {}
+
+    bool shouldVisitTemplateInstantiations() const { return true; }
+    bool shouldVisitImplicitCode() const { return true; }
+
+    bool VisitDecl(Decl* decl) {
+        for (const auto* attr : decl->attrs()) {
+            markAttrNames(attr);
+        }
+        return true;
+    }
+
+    bool VisitValueDecl(ValueDecl* decl) {
+        markType(decl->getType());
+        return true;
+    }
+
+    bool VisitAttributedStmt(AttributedStmt* stmt) {
+        for (const auto* attr : stmt->getAttrs()) {
+            markAttrNames(attr);
+        }
+        return true;
+    }
+
+    bool VisitExpr(Expr* expr) {
+        markType(expr->getType());
+        return true;
+    }
+
+    bool VisitDeclRefExpr(DeclRefExpr* ref) {
+        mark(ref->getDecl());
+        mark(ref->getFoundDecl());
+        return true;
+    }
+
+    bool VisitMemberExpr(MemberExpr* expr) {
+        mark(expr->getMemberDecl());
+        return true;
+    }
+
+    bool VisitOverloadExpr(OverloadExpr* expr) {
+        for (const auto* decl : expr->decls()) {
+            mark(decl);
+        }
+        return true;
+    }
+
+    bool VisitCXXConstructExpr(CXXConstructExpr* expr) {
+        mark(expr->getConstructor());
+        return true;
+    }
+
+    bool VisitCXXNewExpr(CXXNewExpr* expr) {
+        mark(expr->getOperatorNew());
+        mark(expr->getOperatorDelete());
+        return true;
+    }
+
+    bool VisitCXXDeleteExpr(CXXDeleteExpr* expr) {
+        mark(expr->getOperatorDelete());
+        return true;
+    }
+
+    bool VisitTagType(TagType* type) {
+        mark(type->getDecl());
+        return true;
+    }
+
+    bool VisitTypedefType(TypedefType* type) {
+        mark(type->getDecl());
+        return true;
+    }
+
+    bool VisitUsingType(UsingType* type) {
+        mark(type->getFoundDecl());
+        return true;
+    }
+
+    bool VisitTemplateSpecializationType(TemplateSpecializationType* type) {
+        mark(type->getTemplateName().getAsTemplateDecl());
+        return true;
+    }
+
+    bool VisitDeducedTemplateSpecializationType(DeducedTemplateSpecializationType* type) {
+        mark(type->getTemplateName().getAsTemplateDecl());
+        return true;
+    }
+
+    void mark(const Decl* decl) {
+        if (const auto* key = decl ? getKey(decl) : nullptr) {
+            _reachable.insert(key);
+        }
+    }
+
+   private:
+    // Sugar of the type refers to typedefs and templates, attributed ones also by attributes
+    void markType(QualType type) {
+        if (type.isNull()) {
+            return;
+        }
+        for (const auto* attr : _attrTypeMap.get(_ctx, type)) {
+            markAttrNames(attr);
+        }
+        TraverseType(type);
+    }
+
+    // Arguments of OKL attributes are kept as text, so declarations are found by name
+    void markAttrNames(const Attr* attr) {
+        if (!attr || !isOklAttribute(*attr) || !_visitedAttrs.insert(attr).second) {
+            return;
+        }
+        auto text = getSourceText(getAttrFullSourceRange(*attr), _ctx);
+        for (size_t i = 0; i < text.size();) {
+            if (!std::isalpha(static_cast<unsigned char>(text[i])) && text[i] != '_') {
+                ++i;
+                continue;
+            }
+            auto begin = i;
+            while (i < text.size() &&
+                   (std::isalnum(static_cast<unsigned char>(text[i])) || text[i] == '_')) {
+                ++i;
+            }
+            auto it = _names.find(text.substr(begin, i - begin));
+            if (it != _names.end()) {
+                _reachable.insert(it->second.begin(), it->second.end());
+            }
+        }
+    }
+
+    ASTContext& _ctx;
+    AttributedTypeMap& _attrTypeMap;
+    std::set<const Decl*>& _reachable;
+    const std::map<std::string, std::vector<const Decl*>>& _names;
+    std::set<const Attr*> _visitedAttrs;
+};
+
+class DeadDeclEliminator {
+   public:
+    explicit DeadDeclEliminator(SessionStage& stage)
+        : _stage(stage),
+          _sm(stage.getCompiler().getSourceManager()),
+          _ctx(stage.getCompiler().getASTContext()) {}
+
+    void run(const std::vector<const FunctionDecl*>& kernels) {
+        collectDecls(*_ctx.getTranslationUnitDecl());
+        auto groups = groupDecls();
+
+        std::set<const Decl*> reachable;
+        ReachabilityVisitor visitor(_stage, reachable, _names);
+        for (const auto* kernel : kernels) {
+            visitor.mark(kernel);
+        }
+
+        // Traversal of reachable declarations makes more of them reachable
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (auto& group : groups) {
+                if (group.isTraversed || (group.isRemovable && !isReachable(group, reachable))) {
+                    continue;
+                }
+                group.isTraversed = true;
+                changed = true;
+                for (const auto* decl : group.decls) {
+                    visitor.mark(decl);
+                    visitor.TraverseDecl(const_cast<Decl*>(decl));
+                }
+            }
+        }
+
+        auto& rewriter = _stage.getRewriter();
+        for (const auto& group : groups) {
+            if (group.isTraversed) {
+                continue;
+            }
+            rewriter.InsertTextBefore(group.range.getBegin(), "\n#if 0\n");
+            rewriter.InsertTextAfterToken(group.range.getEnd(), "\n#endif\n");
+        }
+    }
+
+   private:
+    struct Candidate {
+        const Decl* decl;
+        SourceRange range;
+        bool isRemovable;
+    };
+
+    bool isReachable(const DeclGroup& group, const std::set<const Decl*>& reachable) {
+        return std::any_of(group.decls.begin(), group.decls.end(), [&](const Decl* decl) {
+            return reachable.count(getKey(decl)) != 0;
+        });
+    }
+
+    // Declarations of system headers are restored as includes, so only emitted ones are collected
+    bool isEmitted(SourceLocation loc) {
+        auto fileLoc = _sm.getFileLoc(loc);
+        return fileLoc.isValid() && !_sm.isInSystemHeader(fileLoc);
+    }
+
+    void collectDecls(const DeclContext& ctx) {
+        for (const auto* decl : ctx.decls()) {
+            if (!decl || decl->isImplicit() || !isEmitted(decl->getLocation())) {
+                continue;
+            }
+            const auto* linkage = dyn_cast<LinkageSpecDecl>(decl);
+            if (isa<NamespaceDecl>(decl) || (linkage && linkage->hasBraces())) {
+                collectDecls(*cast<DeclContext>(decl));
+                continue;
+            }
+            addCandidate(*decl);
+        }
+    }
+
+    void addCandidate(const Decl& decl) {
+        const auto& opts = _ctx.getLangOpts();
+        auto begin = decl.getBeginLoc();
+        // Leading attributes precede the range of the declaration
+        for (const auto* attr : decl.attrs()) {
+            auto attrBegin = attr ? getAttrFullSourceRange(*attr).getBegin() : SourceLocation();
+            if (attrBegin.isFileID() && begin.isFileID() &&
+                _sm.isWrittenInSameFile(attrBegin, begin) &&
+                _sm.isBeforeInTranslationUnit(attrBegin, begin)) {
+                begin = attrBegin;
+            }
+        }
+        auto end = getDeclEnd(decl, _sm, opts);
+
+        auto isRemovable = isRemovableKind(decl) && !hasKernelAttr(decl) && begin.isFileID() &&
+                           end.isValid() && end.isFileID() &&
+                           _sm.isWrittenInSameFile(begin, end) && getKey(&decl);
+        if (const auto* var = dyn_cast<VarDecl>(&decl)) {
+            isRemovable &= !(var->getInit() && var->getInit()->HasSideEffects(_ctx));
+        }
+        if (isRemovable) {
+            auto text = getSourceText(SourceRange{begin, end}, _ctx);
+            // Directive inside would be skipped together with the declaration
+            auto pos = text.find('#');
+            for (; pos != std::string::npos; pos = text.find('#', pos + 1)) {
+                auto lineBegin = text.find_last_not_of(" \t", pos == 0 ? 0 : pos - 1);
+                if (pos == 0 || lineBegin == std::string::npos || text[lineBegin] == '\n') {
+                    isRemovable = false;
+                    break;
+                }
+            }
+        }
+        if (!isRemovable) {
+            end = decl.getEndLoc();
+        }
+
+        _candidates.push_back({&decl, {begin, end}, isRemovable});
+        const auto* key = getKey(&decl);
+        if (!key) {
+            return;
+        }
+        if (const auto* named = dyn_cast<NamedDecl>(&decl); named && named->getIdentifier()) {
+            _names[named->getName().str()].push_back(key);
+        }
+        if (const auto* enumDecl = dyn_cast<EnumDecl>(&decl)) {
+            for (const auto* enumerator : enumDecl->enumerators()) {
+                _names[enumerator->getName().str()].push_back(key);
+            }
+        }
+    }
+
+    // Candidates are in source order of each file, overlapping ones are merged
+    std::vector<DeclGroup> groupDecls() {
+        std::vector<DeclGroup> groups;
+        for (const auto& candidate : _candidates) {
+            auto& range = candidate.range;
+            auto* last = groups.empty() ? nullptr : &groups.back();
+            auto overlaps = last && range.getBegin().isFileID() &&
+                            last->range.getEnd().isFileID() &&
+                            _sm.isWrittenInSameFile(range.getBegin(), last->range.getEnd()) &&
+                            !_sm.isBeforeInTranslationUnit(last->range.getEnd(), range.getBegin());
+            if (!overlaps) {
+                groups.push_back({{}, range, true, false});
+                last = &groups.back();
+            }
+            last->decls.push_back(candidate.decl);
+            last->isRemovable &= candidate.isRemovable;
+            if (_sm.isBeforeInTranslationUnit(last->range.getEnd(), range.getEnd())) {
+                last->range.setEnd(range.getEnd());
+            }
+        }
+        return groups;
+    }
+
+    SessionStage& _stage;
+    const SourceManager& _sm;
+    ASTContext& _ctx;
+    std::vector<Candidate> _candidates;
+    std::map<std::string, std::vector<const Decl*>> _names;
+};
+}  // namespace
+
+void eliminateDeadDecls(SessionStage& stage, const std::vector<const FunctionDecl*>& kernels) {
+    DeadDeclEliminator(stage).run(kernels);
+}
+
+}  // namespace oklt
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+
+namespace clang {
+class FunctionDecl;
+}  // namespace clang
+
+namespace oklt {
+
+class SessionStage;
+
+/**
+ * @brief Excludes declarations of the main file and user headers, that are unreachable from the
+ * kernels, from the fused output: the rewritten text of each of them is wrapped into `#if 0`, so
+ * the preprocessor fusing includes drops it. A declaration is reachable if a reachable one refers
+ * to it by a call, a type, a reference to a variable or enumerator, or by name in arguments of
+ * an OKL attribute. Declarations expanded from macros, spanning preprocessor directives or with
+ * side effects of initialization are always kept, as well as everything they refer to.
+ * @param stage The session stage.
+ * @param kernels The @kernel functions.
+ */
+void eliminateDeadDecls(SessionStage& stage,
+                        const std::vector<const clang::FunctionDecl*>& kernels);
+
+}  // namespace oklt
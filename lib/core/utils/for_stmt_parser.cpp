@@ -2,17 +2,24 @@
 
 #include "attributes/frontend/params/tile.h"
 #include "core/handler_manager/handler_manager.h"
+#include "core/sema/okl_sema_ctx.h"
 #include "core/sema/okl_sema_info.h"
 #include "core/transpiler_session/session_stage.h"
+#include "core/utils/constant_params.h"
 #include "core/utils/range_to_string.h"
 
 #include <clang/AST/AST.h>
 #include <clang/AST/Expr.h>
 #include <clang/AST/ParentMapContext.h>
+#include <clang/Lex/Preprocessor.h>
 #include <llvm/Support/Casting.h>
 
 #include <tl/expected.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
 namespace {
 using namespace oklt;
 using namespace clang;
@@ -41,22 +48,140 @@ UnOp toOkl(UnaryOperatorKind uok) {
     return it != clang2okl.end() ? it->second : UnOp::Other;
 }
 
-bool EvaluateAsSizeT(const Expr* E, llvm::APSInt& Into, const ASTContext& ctx) {
-    unsigned BitsInSizeT = ctx.getTypeSize(ctx.getSizeType());
+// Distance between bounds divided by the step, rounded up. 0 if unknown or the loop is empty
+size_t getTripCount(const OklLoopInfo& loop, const ASTContext& ctx, const ConstantParams& params) {
+    if (!loop.range.start || !loop.range.end) {
+        return 0;
+    }
+    auto start = evaluateWithConstantParams(*loop.range.start, ctx, params);
+    auto end = evaluateWithConstantParams(*loop.range.end, ctx, params);
+    std::optional<int64_t> step = 1;
+    bool isInc = loop.inc.op.uo == UnOp::PreInc || loop.inc.op.uo == UnOp::PostInc;
+    if (loop.inc.val) {
+        auto op = loop.inc.op.bo;
+        isInc = op == BinOp::AddAssign;
+        step = isInc || op == BinOp::RemoveAssign
+                   ? evaluateWithConstantParams(*loop.inc.val, ctx, params)
+                   : std::nullopt;
+    } else if (!loop.isUnary()) {
+        step = std::nullopt;
+    }
+    if (!start || !end || !step || *step <= 0) {
+        return 0;
+    }
 
-    Expr::EvalResult ExprResult;
-    if (!E->EvaluateAsInt(ExprResult, ctx, Expr::SE_AllowSideEffects)) {
-        return false;
+    // Condition must bound the iteration variable in the direction of the step
+    int64_t distance = 0;
+    switch (loop.condition.op) {
+        case BinOp::Lt:
+        case BinOp::Le:
+            if (!isInc) {
+                return 0;
+            }
+            distance = *end - *start + (loop.condition.op == BinOp::Le ? 1 : 0);
+            break;
+        case BinOp::Gt:
+        case BinOp::Ge:
+            if (isInc) {
+                return 0;
+            }
+            distance = *start - *end + (loop.condition.op == BinOp::Ge ? 1 : 0);
+            break;
+        default:
+            return 0;
     }
+    return distance > 0 ? static_cast<size_t>((distance + *step - 1) / *step) : 0;
+}
 
-    Into = ExprResult.Val.getInt();
-    if (Into.isNegative() || !Into.isIntN(BitsInSizeT)) {
-        return false;
+std::optional<int64_t> evaluateConstant(const ValueDecl& decl,
+                                        const ASTContext& ctx,
+                                        const ConstantParams& params) {
+    if (const auto* enumConst = dyn_cast<EnumConstantDecl>(&decl)) {
+        return enumConst->getInitVal().getExtValue();
+    }
+    const auto* var = dyn_cast<VarDecl>(&decl);
+    if (!var || !var->getType().isConstQualified() || !var->getType()->isIntegerType() ||
+        !var->getInit()) {
+        return std::nullopt;
     }
+    return evaluateWithConstantParams(*var->getInit(), ctx, params);
+}
+
+// Declaration of the name visible at the loop: local declarations of enclosing blocks, that
+// precede the loop, then declarations of the translation unit
+const ValueDecl* lookupName(ASTContext& ctx, const Stmt& stmt, const std::string& name) {
+    const Stmt* current = &stmt;
+    for (;;) {
+        auto parents = ctx.getParents(*current);
+        const auto* parent = parents.size() == 1 ? parents[0].get<Stmt>() : nullptr;
+        if (!parent) {
+            break;
+        }
+        if (const auto* block = dyn_cast<CompoundStmt>(parent)) {
+            const ValueDecl* found = nullptr;
+            for (const auto* child : block->body()) {
+                if (child == current) {
+                    break;
+                }
+                const auto* declStmt = dyn_cast<DeclStmt>(child);
+                if (!declStmt) {
+                    continue;
+                }
+                for (const auto* decl : declStmt->decls()) {
+                    const auto* value = dyn_cast<ValueDecl>(decl);
+                    if (value && value->getNameAsString() == name) {
+                        found = value;
+                    }
+                }
+            }
+            if (found) {
+                return found;
+            }
+        }
+        current = parent;
+    }
+
+    auto result = ctx.getTranslationUnitDecl()->lookup(&ctx.Idents.get(name));
+    return result.isSingleResult() ? dyn_cast<ValueDecl>(result.front()) : nullptr;
+}
+
+// @tile size is kept as source text, so it is folded if it is an integer literal, a name of
+// a constant, an enumerator or a bound parameter, or an object-like macro expanding to one of them
+std::optional<int64_t> evaluateTileSize(SessionStage& stage,
+                                        const OklLoopInfo& loop,
+                                        std::string tileSize,
+                                        const ConstantParams& params) {
+    auto& ctx = stage.getCompiler().getASTContext();
+    auto& pp = stage.getCompiler().getPreprocessor();
+    for (size_t depth = 0; depth < 8; ++depth) {
+        char* literalEnd = nullptr;
+        auto literal = std::strtoll(tileSize.c_str(), &literalEnd, 10);
+        if (!tileSize.empty() && !*literalEnd) {
+            return literal;
+        }
+        if (tileSize.empty() || !std::all_of(tileSize.begin(), tileSize.end(), [](char c) {
+                return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+            })) {
+            return std::nullopt;
+        }
+
+        for (const auto& [param, value] : params) {
+            if (param->getNameAsString() == tileSize) {
+                return value;
+            }
+        }
+        if (const auto* decl = lookupName(ctx, loop.stmt, tileSize)) {
+            return evaluateConstant(*decl, ctx, params);
+        }
 
-    Into = Into.zext(BitsInSizeT);
-    return true;
-};
+        const auto* macro = pp.getMacroInfo(&ctx.Idents.get(tileSize));
+        if (!macro || !macro->isObjectLike() || macro->getNumTokens() != 1) {
+            return std::nullopt;
+        }
+        tileSize = pp.getSpelling(macro->getReplacementToken(0));
+    }
+    return std::nullopt;
+}
 
 }  // namespace
 
@@ -64,7 +189,6 @@ namespace oklt {
 tl::expected<OklLoopInfo, Error> parseForStmt(SessionStage& stage,
                                               const clang::ForStmt& s,
                                               const clang::Attr* a) {
-    auto& ctx = stage.getCompiler().getASTContext();
     OklLoopInfo ret{.attr = a, .stmt = s};
     const Expr *start, *end = nullptr;
 
@@ -166,31 +290,32 @@ tl::expected<OklLoopInfo, Error> parseForStmt(SessionStage& stage,
         ret.inc.val = node->getRHS();
     }
 
-    ret.range.size = 0;
+    ConstantParams noParams;
+    auto* kernelInfo = stage.tryEmplaceUserCtx<OklSemaCtx>().getParsingKernelInfo();
+    evaluateLoopSizes(stage, ret, kernelInfo ? kernelInfo->constantParams : noParams);
 
-    // Determinate range size
-    llvm::APSInt start_i, end_i;
-    if (EvaluateAsSizeT(start, start_i, ctx) && EvaluateAsSizeT(end, end_i, ctx)) {
-        start_i.setIsSigned(true);
-        end_i.setIsSigned(true);
-        if (ret.IsInc()) {
-            end_i -= start_i;
-            ret.range.size = end_i.getZExtValue();
-        } else {
-            start_i -= end_i;
-            ret.range.size = start_i.getZExtValue();
-        }
-    }
+    return ret;
+}
+
+void evaluateLoopSizes(SessionStage& stage, OklLoopInfo& loop, const ConstantParams& params) {
+    auto& ctx = stage.getCompiler().getASTContext();
+    loop.range.size = getTripCount(loop, ctx, params);
 
     // Ugly way to retireve tile size
-    if (a) {
+    if (loop.attr) {
         auto& am = stage.getAttrManager();
-        auto params = am.parseAttr(stage, *a);
-        if (params && params->type() == typeid(TileParams)) {
-            ret.tileSize = std::any_cast<TileParams>(am.parseAttr(stage, *a).value()).tileSize;
+        auto attrParams = am.parseAttr(stage, *loop.attr);
+        if (attrParams && attrParams->type() == typeid(TileParams)) {
+            loop.tileSize = std::any_cast<TileParams>(attrParams.value()).tileSize;
+            // Only bound parameters are replaced: they are unnamed in device kernels
+            for (const auto& [param, value] : params) {
+                if (param->getNameAsString() == loop.tileSize) {
+                    loop.tileSize = std::to_string(value);
+                }
+            }
+            auto value = evaluateTileSize(stage, loop, loop.tileSize, params);
+            loop.tileSizeValue = value && *value > 0 ? std::make_optional(*value) : std::nullopt;
         }
     }
-
-    return ret;
 }
 }  // namespace oklt
@@ -0,0 +1,195 @@
+#include "attributes/attribute_names.h"
+#include "core/utils/loop_dependencies.h"
+
+#include <clang/AST/AST.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+#include <clang/Basic/Builtins.h>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+const VarDecl* getBaseVarDecl(const Expr* expr) {
+    while (expr) {
+        expr = expr->IgnoreParenImpCasts();
+        if (const auto* declRef = dyn_cast<DeclRefExpr>(expr)) {
+            return dyn_cast<VarDecl>(declRef->getDecl());
+        }
+        if (const auto* subscript = dyn_cast<ArraySubscriptExpr>(expr)) {
+            expr = subscript->getBase();
+            continue;
+        }
+        if (const auto* member = dyn_cast<MemberExpr>(expr)) {
+            expr = member->getBase();
+            continue;
+        }
+        if (const auto* unary = dyn_cast<UnaryOperator>(expr)) {
+            expr = unary->getSubExpr();
+            continue;
+        }
+        if (const auto* binary = dyn_cast<BinaryOperator>(expr)) {
+            // pointer arithmetic, e.g. *(ptr + i)
+            expr = binary->getLHS()->getType()->isPointerType() ? binary->getLHS()
+                                                                : binary->getRHS();
+            continue;
+        }
+        return nullptr;
+    }
+    return nullptr;
+}
+
+bool isPointerLike(const VarDecl& var) {
+    auto type = var.getType();
+    return type->isPointerType() || type->isReferenceType() || type->isArrayType();
+}
+
+bool isRestrict(const VarDecl& var) {
+    if (var.getType().isRestrictQualified()) {
+        return true;
+    }
+    for (const auto* attr : var.attrs()) {
+        if (attr && attr->getNormalizedFullName() == RESTRICT_ATTR_NAME) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool mayAlias(const VarDecl* lhs, const VarDecl* rhs) {
+    if (!lhs || !rhs || lhs == rhs) {
+        return true;
+    }
+    if (!isPointerLike(*lhs) || !isPointerLike(*rhs)) {
+        return false;
+    }
+    // Two distinct arrays never overlap
+    if (lhs->getType()->isArrayType() && rhs->getType()->isArrayType()) {
+        return false;
+    }
+    return !isRestrict(*lhs) && !isRestrict(*rhs);
+}
+
+bool isPureCall(const CallExpr& call) {
+    const auto* callee = call.getDirectCallee();
+    if (!callee) {
+        return false;
+    }
+    // Pure math builtins and functions with no way to write memory of the caller, errno written
+    // by math functions is thread local
+    if (auto id = callee->getBuiltinID()) {
+        const auto& builtins = callee->getASTContext().BuiltinInfo;
+        if (builtins.isConst(id) || builtins.isPure(id) || builtins.isConstWithoutErrno(id)) {
+            return true;
+        }
+    }
+    if (callee->hasAttr<ConstAttr>() || callee->hasAttr<PureAttr>()) {
+        return true;
+    }
+    for (const auto* param : callee->parameters()) {
+        if (param && isPointerLike(*param)) {
+            return false;
+        }
+    }
+    return callee->isConstexpr();
+}
+
+class AccessCollector : public RecursiveASTVisitor<AccessCollector> {
+   public:
+    explicit AccessCollector(const Stmt& root)
+        : _root(root.getSourceRange()) {}
+
+    bool VisitDeclRefExpr(DeclRefExpr* expr) {
+        if (const auto* var = dyn_cast<VarDecl>(expr->getDecl()); isOuter(var)) {
+            _info.accessed.insert(var);
+        }
+        return true;
+    }
+
+    bool VisitBinaryOperator(BinaryOperator* op) {
+        if (op->isAssignmentOp()) {
+            markWritten(op->getLHS());
+        }
+        return true;
+    }
+
+    bool VisitUnaryOperator(UnaryOperator* op) {
+        if (op->isIncrementDecrementOp()) {
+            markWritten(op->getSubExpr());
+        }
+        return true;
+    }
+
+    bool VisitCXXOperatorCallExpr(CXXOperatorCallExpr* call) {
+        if (call->isAssignmentOp() && call->getNumArgs() > 0) {
+            markWritten(call->getArg(0));
+        }
+        return true;
+    }
+
+    bool VisitCallExpr(CallExpr* call) {
+        if (!isa<CXXOperatorCallExpr>(call) && !isPureCall(*call)) {
+            _info.hasUnknownSideEffects = true;
+        }
+        return true;
+    }
+
+    StmtAccessInfo& getInfo() { return _info; }
+
+   private:
+    bool isOuter(const VarDecl* var) const {
+        if (!var) {
+            return false;
+        }
+        auto loc = var->getLocation();
+        return !(_root.getBegin() <= loc && loc <= _root.getEnd());
+    }
+
+    void markWritten(const Expr* expr) {
+        const auto* var = getBaseVarDecl(expr);
+        if (!var) {
+            // INFO: can't find out what is written, consider worst case
+            _info.hasUnknownSideEffects = true;
+            return;
+        }
+        if (isOuter(var)) {
+            _info.written.insert(var);
+            return;
+        }
+        // INFO: local pointer or reference can point to memory of outer variables
+        auto type = var->getType();
+        const auto* ref = dyn_cast<DeclRefExpr>(expr->IgnoreParenImpCasts());
+        if (type->isReferenceType() || (type->isPointerType() && !(ref && ref->getDecl() == var))) {
+            _info.hasUnknownSideEffects = true;
+        }
+    }
+
+    SourceRange _root;
+    StmtAccessInfo _info;
+};
+
+bool hasConflict(const StmtAccessInfo& writer, const StmtAccessInfo& other) {
+    for (const auto* written : writer.written) {
+        for (const auto* accessed : other.accessed) {
+            if (mayAlias(written, accessed)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+}  // namespace
+
+StmtAccessInfo collectStmtAccesses(const Stmt& stmt) {
+    AccessCollector collector(stmt);
+    collector.TraverseStmt(const_cast<Stmt*>(&stmt));
+    return std::move(collector.getInfo());
+}
+
+bool areStmtsIndependent(const StmtAccessInfo& first, const StmtAccessInfo& second) {
+    if (first.hasUnknownSideEffects || second.hasUnknownSideEffects) {
+        return false;
+    }
+    return !hasConflict(first, second) && !hasConflict(second, first);
+}
+
+}  // namespace oklt
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <set>
+
+namespace clang {
+class Stmt;
+class VarDecl;
+}  // namespace clang
+
+namespace oklt {
+
+/**
+ * @brief Variables declared outside of a statement and accessed inside of it.
+ */
+struct StmtAccessInfo {
+    std::set<const clang::VarDecl*> accessed;  ///< Variables that are read or written.
+    std::set<const clang::VarDecl*> written;   ///< Variables that are written, or whose pointee is.
+    bool hasUnknownSideEffects = false;        ///< Call or write via local pointer.
+};
+
+/**
+ * @brief Collects outer variables accessed by the statement.
+ * @param stmt The statement, usually an attributed for loop.
+ * @return Access information of the statement.
+ */
+StmtAccessInfo collectStmtAccesses(const clang::Stmt& stmt);
+
+/**
+ * @brief Checks if two statements can be executed in any order or concurrently, i.e. neither of
+ * them writes memory that the other one can access. Pointers are assumed to alias unless one of
+ * them is restrict qualified or marked with @restrict.
+ * @return Boolean indicating whether the statements are independent.
+ */
+bool areStmtsIndependent(const StmtAccessInfo& first, const StmtAccessInfo& second);
+
+}  // namespace oklt
@@ -0,0 +1,405 @@
+#include "attributes/attribute_names.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/transpiler_session/transpiler_session.h"
+#include "core/utils/attributes.h"
+#include "core/utils/outer_fusion.h"
+#include "core/utils/range_to_string.h"
+#include "core/utils/read_only_params.h"
+
+#include <clang/AST/AST.h>
+#include <clang/AST/ParentMapContext.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <optional>
+#include <set>
+#include <vector>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+// How one loop accesses memory behind a pointer argument
+struct GlobalAccess {
+    bool isWritten = false;
+    bool isBlockLocal = true;       ///< Every access is a subscript by an index of the block.
+    std::set<std::string> indices;  ///< Source text of the subscripts.
+};
+
+using GlobalAccesses = std::map<const ParmVarDecl*, GlobalAccess>;
+
+// Distance between consecutive values of the iteration variable and their number, 0 if unknown
+struct VarExtent {
+    int64_t step = 1;
+    size_t tripCount = 0;
+};
+
+struct Phase {
+    std::vector<std::string> launch;  ///< Signatures of loops, that define launch dimensions.
+    std::map<const ValueDecl*, VarExtent> loopVars;  ///< Iteration variables of those loops.
+    std::set<const ValueDecl*> outerVars;  ///< Iteration variables of @outer ones among them.
+    GlobalAccesses accesses;
+    bool hasReturn = false;
+    bool declaresShared = false;
+};
+
+std::string getLoopSignature(ASTContext& ctx, const OklLoopInfo& loop) {
+    std::string signature = loop.var.name + "|" + loop.tileSize;
+    for (auto type : loop.type) {
+        signature += "|" + std::to_string(static_cast<int>(type));
+    }
+    for (auto axis : loop.axis) {
+        signature += "|" + std::to_string(static_cast<int>(axis));
+    }
+    for (const auto* expr : {loop.range.start, loop.range.end, loop.inc.val}) {
+        signature += "|" + (expr ? getSourceText(*expr, ctx) : std::string());
+    }
+    auto incOp = loop.isUnary() ? static_cast<int>(loop.inc.op.uo)
+                                : static_cast<int>(loop.inc.op.bo);
+    return signature + "|" + std::to_string(static_cast<int>(loop.condition.op)) + "|" +
+           std::to_string(incOp);
+}
+
+VarExtent getVarExtent(const ASTContext& ctx, const OklLoopInfo& loop) {
+    VarExtent extent{.step = 0, .tripCount = loop.range.size};
+    if (!loop.inc.val) {
+        extent.step = loop.isUnary() ? 1 : 0;
+        return extent;
+    }
+    Expr::EvalResult step;
+    if (loop.inc.val->EvaluateAsInt(step, ctx)) {
+        extent.step = std::abs(step.Val.getInt().getExtValue());
+    }
+    return extent;
+}
+
+// Launcher derives launch dimensions from the chain of the first child loops
+void collectLaunchLoops(ASTContext& ctx, const OklLoopInfo& loop, Phase& phase) {
+    for (const auto* current = &loop; current;) {
+        if (!current->isRegular()) {
+            phase.launch.push_back(getLoopSignature(ctx, *current));
+            if (current->var.varDecl) {
+                phase.loopVars[current->var.varDecl] = getVarExtent(ctx, *current);
+                if (current->has(LoopType::Outer)) {
+                    phase.outerVars.insert(current->var.varDecl);
+                }
+            }
+        }
+        current = current->children.empty() ? nullptr : &current->children.front();
+    }
+}
+
+bool hasSharedAttr(const Decl& decl) {
+    return std::any_of(decl.attrs().begin(), decl.attrs().end(), [](const Attr* attr) {
+        return attr && attr->getNormalizedFullName() == SHARED_ATTR_NAME;
+    });
+}
+
+class PhaseVisitor : public RecursiveASTVisitor<PhaseVisitor> {
+   public:
+    PhaseVisitor(ASTContext& ctx, Phase& phase)
+        : _ctx(ctx),
+          _phase(phase) {}
+
+    bool VisitReturnStmt(ReturnStmt*) {
+        _phase.hasReturn = true;
+        return true;
+    }
+
+    bool VisitVarDecl(VarDecl* decl) {
+        if (decl->hasAttrs() && hasSharedAttr(*decl)) {
+            _phase.declaresShared = true;
+        }
+        return true;
+    }
+
+    bool VisitDeclRefExpr(DeclRefExpr* ref) {
+        const auto* param = dyn_cast<ParmVarDecl>(ref->getDecl());
+        if (!param || !param->getType()->isPointerType()) {
+            return true;
+        }
+        auto& access = _phase.accesses[param];
+        access.isWritten |= !isReadOnlyUse(_ctx, *ref);
+
+        const auto* index = getSubscript(*ref);
+        if (index && isBlockIndex(*index)) {
+            access.indices.insert(getSourceText(*index, _ctx));
+        } else {
+            access.isBlockLocal = false;
+        }
+        return true;
+    }
+
+   private:
+    const Expr* getSubscript(const DeclRefExpr& ref) {
+        const Expr* current = &ref;
+        for (;;) {
+            auto parents = _ctx.getParents(*current);
+            const auto* parent = parents.size() == 1 ? parents[0].get<Expr>() : nullptr;
+            if (!parent) {
+                return nullptr;
+            }
+            if (isa<ParenExpr, ImplicitCastExpr>(parent)) {
+                current = parent;
+                continue;
+            }
+            const auto* subscript = dyn_cast<ArraySubscriptExpr>(parent);
+            return subscript && subscript->getBase() == current ? subscript->getIdx() : nullptr;
+        }
+    }
+
+    // Index is an affine combination of iteration variables of launch loops with constant
+    // coefficients, plus constant arguments and literals
+    bool collectAffineTerms(const Expr& expr,
+                            int64_t scale,
+                            std::map<const ValueDecl*, int64_t>& terms) {
+        const auto* e = expr.IgnoreParenImpCasts();
+        Expr::EvalResult value;
+        if (e->EvaluateAsInt(value, _ctx)) {
+            return true;
+        }
+        if (const auto* ref = dyn_cast<DeclRefExpr>(e)) {
+            const auto* decl = ref->getDecl();
+            if (_phase.loopVars.count(decl)) {
+                terms[decl] += scale;
+                return true;
+            }
+            // INFO: the same offset for every block, since accesses have the same index
+            const auto* param = dyn_cast<ParmVarDecl>(decl);
+            return param && param->getType().isConstQualified() &&
+                   param->getType()->isIntegerType();
+        }
+        if (const auto* unOp = dyn_cast<UnaryOperator>(e)) {
+            return unOp->getOpcode() == UO_Minus &&
+                   collectAffineTerms(*unOp->getSubExpr(), -scale, terms);
+        }
+        const auto* binOp = dyn_cast<BinaryOperator>(e);
+        if (!binOp) {
+            return false;
+        }
+        const auto* lhs = binOp->getLHS();
+        const auto* rhs = binOp->getRHS();
+        switch (binOp->getOpcode()) {
+            case BO_Add:
+                return collectAffineTerms(*lhs, scale, terms) &&
+                       collectAffineTerms(*rhs, scale, terms);
+            case BO_Sub:
+                return collectAffineTerms(*lhs, scale, terms) &&
+                       collectAffineTerms(*rhs, -scale, terms);
+            case BO_Mul:
+                if (rhs->EvaluateAsInt(value, _ctx)) {
+                    std::swap(lhs, rhs);
+                } else if (!lhs->EvaluateAsInt(value, _ctx)) {
+                    return false;
+                }
+                return collectAffineTerms(*rhs, scale * value.Val.getInt().getExtValue(), terms);
+            default:
+                return false;
+        }
+    }
+
+    // Every block accesses only its own elements, if the index is injective over iteration
+    // variables and depends on all @outer ones, e.g. `b * 32 + j` for `j < 32`, but not `b + j`.
+    // Terms are ordered by the distance between their consecutive values, and each one must be
+    // longer than the span of all shorter ones together
+    bool isBlockIndex(const Expr& expr) {
+        std::map<const ValueDecl*, int64_t> terms;
+        if (!collectAffineTerms(expr, 1, terms)) {
+            return false;
+        }
+        for (const auto* outer : _phase.outerVars) {
+            auto it = terms.find(outer);
+            if (it == terms.end() || it->second == 0) {
+                return false;
+            }
+        }
+
+        // Distance between consecutive values of the term and between its extreme ones
+        std::vector<std::pair<int64_t, std::optional<int64_t>>> units;
+        for (const auto& [var, coef] : terms) {
+            if (coef == 0) {
+                continue;
+            }
+            const auto& extent = _phase.loopVars.at(var);
+            auto unit = std::abs(coef) * extent.step;
+            if (unit == 0) {
+                return false;
+            }
+            auto last = static_cast<int64_t>(extent.tripCount) - 1;
+            units.emplace_back(unit, last < 0 ? std::nullopt : std::make_optional(unit * last));
+        }
+        std::stable_sort(units.begin(), units.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+        int64_t covered = 0;
+        for (size_t i = 0; i < units.size(); ++i) {
+            const auto& [unit, span] = units[i];
+            if (unit <= covered || (!span && i + 1 != units.size())) {
+                return false;
+            }
+            covered += span.value_or(0);
+        }
+        return true;
+    }
+
+    ASTContext& _ctx;
+    Phase& _phase;
+};
+
+Phase collectPhase(ASTContext& ctx, const OklLoopInfo& loop) {
+    Phase phase;
+    collectLaunchLoops(ctx, loop, phase);
+    PhaseVisitor visitor(ctx, phase);
+    visitor.TraverseStmt(const_cast<ForStmt*>(&loop.stmt));
+    return phase;
+}
+
+// Statement of the loop in the enclosing compound statement, i.e. with its attributes
+const Stmt* getStatementNode(ASTContext& ctx, const ForStmt& stmt) {
+    auto parents = ctx.getParents(stmt);
+    if (parents.size() == 1) {
+        if (const auto* attributed = parents[0].get<AttributedStmt>()) {
+            return attributed;
+        }
+    }
+    return &stmt;
+}
+
+bool areAdjacent(ASTContext& ctx, const OklLoopInfo& prev, const OklLoopInfo& next) {
+    const auto* prevNode = getStatementNode(ctx, prev.stmt);
+    const auto* nextNode = getStatementNode(ctx, next.stmt);
+    auto parents = ctx.getParents(*prevNode);
+    const auto* block = parents.size() == 1 ? parents[0].get<CompoundStmt>() : nullptr;
+    if (!block) {
+        return false;
+    }
+    const auto* it = std::find(block->body_begin(), block->body_end(), prevNode);
+    return it != block->body_end() && std::next(it) != block->body_end() &&
+           *std::next(it) == nextNode;
+}
+
+bool haveSameLaunch(const Phase& first,
+                    OklLoopInfo& firstLoop,
+                    const Phase& next,
+                    OklLoopInfo& nextLoop) {
+    if (first.launch != next.launch) {
+        return false;
+    }
+    auto firstSizes = firstLoop.getInnerSizes();
+    auto nextSizes = nextLoop.getInnerSizes();
+    return std::equal(firstSizes.begin(), firstSizes.end(), nextSizes.begin());
+}
+
+bool isRestrict(const ParmVarDecl& param) {
+    if (param.getType().isRestrictQualified()) {
+        return true;
+    }
+    return std::any_of(param.attrs().begin(), param.attrs().end(), [](const Attr* attr) {
+        return attr && attr->getNormalizedFullName() == RESTRICT_ATTR_NAME;
+    });
+}
+
+// Caller can pass overlapping buffers, even through a pointer to const, unless both are restrict
+bool mayOverlap(const ParmVarDecl& lhs, const ParmVarDecl& rhs) {
+    return !(isRestrict(lhs) && isRestrict(rhs));
+}
+
+// Argument written by one loop of the group, that can overlap with another one, accessed by
+// another loop
+bool hasAliasedAccess(const std::vector<Phase>& group) {
+    for (size_t i = 0; i < group.size(); ++i) {
+        for (const auto& [written, access] : group[i].accesses) {
+            if (!access.isWritten) {
+                continue;
+            }
+            for (size_t j = 0; j < group.size(); ++j) {
+                if (i == j) {
+                    continue;
+                }
+                for (const auto& [other, otherAccess] : group[j].accesses) {
+                    if (other != written && mayOverlap(*written, *other)) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+// No block observes a write of another block, if every argument shared by loops of the group is
+// either only read or accessed by all of them at the same element of the block
+bool isIndependent(const std::vector<Phase>& group) {
+    if (hasAliasedAccess(group)) {
+        return false;
+    }
+
+    std::map<const ParmVarDecl*, std::vector<const GlobalAccess*>> shared;
+    for (const auto& phase : group) {
+        for (const auto& [param, access] : phase.accesses) {
+            shared[param].push_back(&access);
+        }
+    }
+    for (const auto& [param, accesses] : shared) {
+        if (accesses.size() < 2 || std::none_of(accesses.begin(), accesses.end(), [](auto* a) {
+                return a->isWritten;
+            })) {
+            continue;
+        }
+        std::set<std::string> indices;
+        for (const auto* access : accesses) {
+            if (!access->isBlockLocal) {
+                return false;
+            }
+            indices.insert(access->indices.begin(), access->indices.end());
+        }
+        if (indices.size() != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+void fuseOuterLoops(SessionStage& stage, std::list<OklLoopInfo*>& loops) {
+    auto& ctx = stage.getCompiler().getASTContext();
+    auto dynamicShared = stage.getSession().getInput().dynamicShared;
+
+    OklLoopInfo* first = nullptr;
+    OklLoopInfo* last = nullptr;
+    std::vector<Phase> group;
+    for (auto* loop : loops) {
+        if (!loop) {
+            continue;
+        }
+        auto phase = collectPhase(ctx, *loop);
+        // Threads, that left the kernel, never reach the barrier between loops
+        auto isFusible = !phase.hasReturn && !(dynamicShared && phase.declaresShared);
+        if (first && isFusible && areAdjacent(ctx, *last, *loop) &&
+            haveSameLaunch(group.front(), *first, phase, *loop)) {
+            group.push_back(std::move(phase));
+            if (isIndependent(group)) {
+                loop->fusedWithPrevious = true;
+                if (stage.getBackend() != TargetBackend::_LAUNCHER) {
+                    stage.pushNote("[@outer] loop is fused into the kernel of the previous loop",
+                                   getAttrFullSourceRange(*loop->attr).getBegin());
+                }
+                last = loop;
+                continue;
+            }
+            phase = std::move(group.back());
+            group.pop_back();
+        }
+
+        group.clear();
+        first = isFusible ? loop : nullptr;
+        if (isFusible) {
+            group.push_back(std::move(phase));
+        }
+        last = loop;
+    }
+}
+
+}  // namespace oklt
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "core/sema/okl_sema_info.h"
+
+#include <list>
+
+namespace oklt {
+
+class SessionStage;
+
+/**
+ * @brief Marks top-level @outer loops, that run in the device kernel of the previous loop after a
+ * block-level barrier instead of a kernel of their own. Consecutive statements are fused if their
+ * launch dimensions are the same, none of them contains return or @shared packed into dynamic
+ * shared memory, and no block can observe a write of another block: every pointer argument
+ * written by one loop and accessed by another is accessed by all of them only by the same
+ * subscript of @outer/@inner iteration variables, that refers to @outer ones.
+ * @param stage The session stage.
+ * @param loops The top-level @outer loops of the kernel in source order.
+ */
+void fuseOuterLoops(SessionStage& stage, std::list<OklLoopInfo*>& loops);
+
+}  // namespace oklt
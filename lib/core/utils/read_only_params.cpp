@@ -0,0 +1,149 @@
+#include "attributes/attribute_names.h"
+#include "core/utils/read_only_params.h"
+
+#include <clang/AST/AST.h>
+#include <clang/AST/ParentMapContext.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+bool hasNoRestrictAttr(const ParmVarDecl& param) {
+    for (const auto* attr : param.attrs()) {
+        if (attr && attr->getNormalizedFullName() == NO_RESTRICT_ATTR_NAME) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool isCandidate(const ParmVarDecl& param) {
+    auto type = param.getType();
+    if (type->isDependentType() || hasNoRestrictAttr(param)) {
+        return false;
+    }
+    // Pointer must be spelled in the declaration, so that `const` applies to its pointee
+    const auto* pointer = dyn_cast<PointerType>(type.getTypePtr());
+    if (!pointer) {
+        return false;
+    }
+    auto pointee = pointer->getPointeeType();
+    return !pointee->isPointerType() && !pointee->isArrayType() && !pointee->isFunctionType() &&
+           !pointee->isVoidType();
+}
+}  // namespace
+
+// Pointer itself can be loaded, shifted by an offset and dereferenced, its pointee only loaded
+bool isReadOnlyUse(ASTContext& ctx, const DeclRefExpr& ref) {
+    const Expr* current = &ref;
+    bool isPointee = false;
+    for (;;) {
+        auto parents = ctx.getParents(*current);
+        if (parents.size() != 1) {
+            return false;
+        }
+        const auto* parent = parents[0].get<Expr>();
+        if (!parent) {
+            // Initializer of another variable or a statement of its own
+            return false;
+        }
+
+        if (isa<ParenExpr>(parent)) {
+            current = parent;
+            continue;
+        }
+        if (const auto* cast = dyn_cast<ImplicitCastExpr>(parent)) {
+            if (isPointee) {
+                return cast->getCastKind() == CK_LValueToRValue;
+            }
+            if (cast->getCastKind() != CK_LValueToRValue && cast->getCastKind() != CK_NoOp) {
+                return false;
+            }
+            current = parent;
+            continue;
+        }
+
+        if (isPointee) {
+            // Field of the pointee, e.g. `ptr[i].x`
+            const auto* member = dyn_cast<MemberExpr>(parent);
+            if (!member || member->isArrow() || member->getType()->isArrayType()) {
+                return false;
+            }
+            current = parent;
+            continue;
+        }
+
+        if (const auto* binOp = dyn_cast<BinaryOperator>(parent)) {
+            if (!binOp->isAdditiveOp() || !binOp->getType()->isPointerType()) {
+                return false;
+            }
+            current = parent;
+            continue;
+        }
+        if (const auto* subscript = dyn_cast<ArraySubscriptExpr>(parent)) {
+            if (subscript->getBase() != current) {
+                return false;
+            }
+            isPointee = true;
+            current = parent;
+            continue;
+        }
+        if (const auto* unOp = dyn_cast<UnaryOperator>(parent)) {
+            if (unOp->getOpcode() != UO_Deref) {
+                return false;
+            }
+            isPointee = true;
+            current = parent;
+            continue;
+        }
+        if (const auto* member = dyn_cast<MemberExpr>(parent)) {
+            if (!member->isArrow() || member->getType()->isArrayType()) {
+                return false;
+            }
+            isPointee = true;
+            current = parent;
+            continue;
+        }
+        return false;
+    }
+}
+
+namespace {
+class ParamUseVisitor : public RecursiveASTVisitor<ParamUseVisitor> {
+   public:
+    ParamUseVisitor(ASTContext& ctx, std::set<const ParmVarDecl*>& readOnly)
+        : _ctx(ctx),
+          _readOnly(readOnly) {}
+
+    bool VisitDeclRefExpr(DeclRefExpr* expr) {
+        const auto* param = dyn_cast<ParmVarDecl>(expr->getDecl());
+        if (param && _readOnly.count(param) && !isReadOnlyUse(_ctx, *expr)) {
+            _readOnly.erase(param);
+        }
+        return true;
+    }
+
+   private:
+    ASTContext& _ctx;
+    std::set<const ParmVarDecl*>& _readOnly;
+};
+}  // namespace
+
+std::set<const ParmVarDecl*> collectReadOnlyParams(const FunctionDecl& func) {
+    std::set<const ParmVarDecl*> readOnly;
+    for (const auto* param : func.parameters()) {
+        if (param && isCandidate(*param)) {
+            readOnly.insert(param);
+        }
+    }
+    if (readOnly.empty() || !func.hasBody()) {
+        return {};
+    }
+
+    ParamUseVisitor visitor(func.getASTContext(), readOnly);
+    visitor.TraverseStmt(func.getBody());
+    return readOnly;
+}
+
+}  // namespace oklt
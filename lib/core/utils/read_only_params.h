@@ -0,0 +1,33 @@
+#pragma once
+
+#include <set>
+
+namespace clang {
+class ASTContext;
+class DeclRefExpr;
+class FunctionDecl;
+class ParmVarDecl;
+}  // namespace clang
+
+namespace oklt {
+
+/**
+ * @brief Finds pointer parameters of the kernel whose pointee is only loaded in the body, i.e.
+ * there are no stores, atomics or increments through the pointer and the pointer never escapes to
+ * a call, another variable or an address-of. Parameters marked with @norestrict, of typedef
+ * pointer types and of pointers to pointers or arrays are skipped.
+ * @param func The kernel function.
+ * @return Read-only pointer parameters.
+ */
+std::set<const clang::ParmVarDecl*> collectReadOnlyParams(const clang::FunctionDecl& func);
+
+/**
+ * @brief Checks if the pointer is only loaded, shifted by an offset or dereferenced to load its
+ * pointee by the expression that refers to it.
+ * @param ctx The AST context.
+ * @param ref The reference to the pointer.
+ * @return Boolean indicating whether the pointee isn't written or escaped by the reference.
+ */
+bool isReadOnlyUse(clang::ASTContext& ctx, const clang::DeclRefExpr& ref);
+
+}  // namespace oklt
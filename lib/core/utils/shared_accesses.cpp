@@ -0,0 +1,147 @@
+#include "attributes/attribute_names.h"
+#include "core/transpiler_session/attributed_type_map.h"
+#include "core/transpiler_session/session_stage.h"
+#include "core/utils/shared_accesses.h"
+
+#include <clang/AST/AST.h>
+#include <clang/AST/ParentMapContext.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+
+#include <functional>
+
+namespace oklt {
+using namespace clang;
+
+namespace {
+const OklLoopInfo::SharedAccess READ = {.read = true, .write = false};
+const OklLoopInfo::SharedAccess WRITE = {.read = false, .write = true};
+const OklLoopInfo::SharedAccess READ_WRITE = {.read = true, .write = true};
+
+// Walks up from the variable through subscripts and field accesses to the load or store
+OklLoopInfo::SharedAccess classifyAccess(ASTContext& ctx, const DeclRefExpr& ref) {
+    const Expr* current = &ref;
+    for (;;) {
+        auto parents = ctx.getParents(*current);
+        if (parents.size() != 1) {
+            return READ_WRITE;
+        }
+        const auto* parent = parents[0].get<Expr>();
+        if (!parent) {
+            // Reference or pointer initialization, return statement, etc.
+            return READ_WRITE;
+        }
+
+        if (isa<ParenExpr>(parent)) {
+            current = parent;
+            continue;
+        }
+        if (const auto* cast = dyn_cast<ImplicitCastExpr>(parent)) {
+            if (cast->getCastKind() == CK_LValueToRValue) {
+                return READ;
+            }
+            current = parent;
+            continue;
+        }
+        if (const auto* subscript = dyn_cast<ArraySubscriptExpr>(parent)) {
+            if (subscript->getBase() != current) {
+                return READ_WRITE;
+            }
+            current = parent;
+            continue;
+        }
+        if (const auto* member = dyn_cast<MemberExpr>(parent)) {
+            if (member->isArrow()) {
+                return READ_WRITE;
+            }
+            current = parent;
+            continue;
+        }
+        if (const auto* unOp = dyn_cast<UnaryOperator>(parent)) {
+            if (unOp->getOpcode() == UO_Deref) {
+                current = parent;
+                continue;
+            }
+            return READ_WRITE;
+        }
+        if (const auto* binOp = dyn_cast<BinaryOperator>(parent)) {
+            if (binOp->getOpcode() == BO_Assign && binOp->getLHS() == current) {
+                return WRITE;
+            }
+            if (binOp->isAdditiveOp() && binOp->getType()->isPointerType()) {
+                current = parent;
+                continue;
+            }
+            return READ_WRITE;
+        }
+        return READ_WRITE;
+    }
+}
+
+// Accesses are summarized into the entry, that is selected by the reference, or are skipped
+using SelectSummary = std::function<OklLoopInfo::SharedAccesses*(const DeclRefExpr&)>;
+
+class SharedAccessVisitor : public RecursiveASTVisitor<SharedAccessVisitor> {
+   public:
+    SharedAccessVisitor(SessionStage& stage, SelectSummary select)
+        : _ctx(stage.getCompiler().getASTContext()),
+          _attrTypeMap(stage.tryEmplaceUserCtx<AttributedTypeMap>()),
+          _select(std::move(select)) {}
+
+    bool VisitDeclRefExpr(DeclRefExpr* expr) {
+        if (!_attrTypeMap.has(_ctx, expr->getType(), {SHARED_ATTR_NAME})) {
+            return true;
+        }
+        auto* accesses = _select(*expr);
+        if (!accesses) {
+            return true;
+        }
+
+        auto access = classifyAccess(_ctx, *expr);
+        auto& summary = (*accesses)[expr->getDecl()];
+        summary.read = summary.read || access.read;
+        summary.write = summary.write || access.write;
+        return true;
+    }
+
+   private:
+    ASTContext& _ctx;
+    AttributedTypeMap& _attrTypeMap;
+    SelectSummary _select;
+};
+}  // namespace
+
+OklLoopInfo::SharedAccesses collectSharedAccesses(SessionStage& stage, const Stmt& stmt) {
+    OklLoopInfo::SharedAccesses accesses;
+    SharedAccessVisitor visitor(stage, [&](const DeclRefExpr&) { return &accesses; });
+    visitor.TraverseStmt(const_cast<Stmt*>(&stmt));
+    return accesses;
+}
+
+std::vector<OklLoopInfo::SharedAccesses> collectSharedAccessesBetween(
+    SessionStage& stage,
+    const Stmt& stmt,
+    const std::list<OklLoopInfo>& loops) {
+    const auto& sm = stage.getCompiler().getSourceManager();
+    std::vector<OklLoopInfo::SharedAccesses> accesses(loops.size() + 1);
+    SharedAccessVisitor visitor(
+        stage, [&](const DeclRefExpr& ref) -> OklLoopInfo::SharedAccesses* {
+            auto loc = sm.getFileLoc(ref.getBeginLoc());
+            size_t idx = 0;
+            for (const auto& loop : loops) {
+                auto range = loop.stmt.getSourceRange();
+                if (sm.isBeforeInTranslationUnit(loc, sm.getFileLoc(range.getBegin()))) {
+                    break;
+                }
+                if (!sm.isBeforeInTranslationUnit(sm.getFileLoc(range.getEnd()), loc)) {
+                    // Accesses of the loop itself are collected with the loop
+                    return nullptr;
+                }
+                ++idx;
+            }
+            return &accesses[idx];
+        });
+    visitor.TraverseStmt(const_cast<Stmt*>(&stmt));
+    return accesses;
+}
+
+}  // namespace oklt
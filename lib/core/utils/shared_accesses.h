@@ -0,0 +1,38 @@
+#pragma once
+
+#include "core/sema/okl_sema_info.h"
+
+#include <list>
+#include <vector>
+
+namespace clang {
+class Stmt;
+}  // namespace clang
+
+namespace oklt {
+
+class SessionStage;
+
+/**
+ * @brief Collects reads and writes of @shared variables in the statement. Increments, compound
+ * assignments, address-of and any use that can't be classified are counted as both.
+ * @param stage The session stage, holding the map of attributed types.
+ * @param stmt The statement, usually a loop.
+ * @return Accesses of each @shared variable.
+ */
+OklLoopInfo::SharedAccesses collectSharedAccesses(SessionStage& stage, const clang::Stmt& stmt);
+
+/**
+ * @brief Collects reads and writes of @shared variables in the statement outside of the given
+ * loops, separately before the first loop, between each two loops and after the last loop.
+ * @param stage The session stage, holding the map of attributed types.
+ * @param stmt The statement, usually a body of a loop.
+ * @param loops The loops nested into the statement, in source order.
+ * @return Accesses of each @shared variable, one entry more than there are loops.
+ */
+std::vector<OklLoopInfo::SharedAccesses> collectSharedAccessesBetween(
+    SessionStage& stage,
+    const clang::Stmt& stmt,
+    const std::list<OklLoopInfo>& loops);
+
+}  // namespace oklt
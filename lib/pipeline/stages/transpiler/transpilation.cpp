@@ -7,6 +7,7 @@
 #include "core/transpiler_session/attributed_type_map.h"
 
 #include "core/transpiler_session/code_generator.h"
+#include "core/transpiler_session/okl_attr_index.h"
 #include "core/transpiler_session/session_stage.h"
 #include "core/transpiler_session/transpilation_node.h"
 #include "core/transpiler_session/transpiler_session.h"
@@ -20,6 +21,8 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+
 namespace {
 
 using namespace oklt;
@@ -66,21 +69,28 @@ int getNodeType(const Stmt& s) {
     return s.getStmtClass();
 }
 
-tl::expected<std::set<const Attr*>, Error> getNodeAttrs(SessionStage& stage, const Decl& decl) {
+tl::expected<std::vector<const Attr*>, Error> getNodeAttrs(SessionStage& stage, const Decl& decl) {
     return stage.getAttrManager().checkAttrs(stage, DynTypedNode::create(decl));
 }
 
-tl::expected<std::set<const Attr*>, Error> tryGetDeclRefExprAttrs(SessionStage& stage,
-                                                                  const clang::DeclRefExpr& expr) {
+tl::expected<std::vector<const Attr*>, Error> tryGetDeclRefExprAttrs(
+    SessionStage& stage,
+    const clang::DeclRefExpr& expr) {
     auto& attrTypeMap = stage.tryEmplaceUserCtx<AttributedTypeMap>();
     auto& ctx = stage.getCompiler().getASTContext();
-    auto attrs = attrTypeMap.get(ctx, expr.getType());
-    auto res = std::set<const Attr*>(attrs.begin(), attrs.end());
+    const auto& attrs = attrTypeMap.get(ctx, expr.getType());
 
+    // order of the desugaring chain, every attribute once
+    std::vector<const Attr*> res;
+    for (const auto* attr : attrs) {
+        if (std::find(res.begin(), res.end(), attr) == res.end()) {
+            res.push_back(attr);
+        }
+    }
     return res;
 }
 
-tl::expected<std::set<const Attr*>, Error> tryGetRecoveryExprAttrs(
+tl::expected<std::vector<const Attr*>, Error> tryGetRecoveryExprAttrs(
     SessionStage& stage,
     const clang::RecoveryExpr& expr) {
     auto subExpr = expr.subExpressions();
@@ -96,8 +106,8 @@ tl::expected<std::set<const Attr*>, Error> tryGetRecoveryExprAttrs(
     return tryGetDeclRefExprAttrs(stage, *declRefExpr);
 }
 
-tl::expected<std::set<const Attr*>, Error> tryGetCallExprAttrs(SessionStage& stage,
-                                                               const clang::CallExpr& expr) {
+tl::expected<std::vector<const Attr*>, Error> tryGetCallExprAttrs(SessionStage& stage,
+                                                                  const clang::CallExpr& expr) {
     // If no errors, call default postValidate.
     if (!expr.containsErrors()) {
         return {};
@@ -122,7 +132,7 @@ tl::expected<std::set<const Attr*>, Error> tryGetCallExprAttrs(SessionStage& sta
     return tryGetDeclRefExprAttrs(stage, *declRefExpr);
 }
 
-tl::expected<std::set<const Attr*>, Error> getNodeAttrs(SessionStage& stage, const Stmt& stmt) {
+tl::expected<std::vector<const Attr*>, Error> getNodeAttrs(SessionStage& stage, const Stmt& stmt) {
     switch (stmt.getStmtClass()) {
         case Stmt::RecoveryExprClass:
             return tryGetRecoveryExprAttrs(stage, cast<RecoveryExpr>(stmt));
@@ -142,7 +152,7 @@ HandleResult runFromRootToLeaves(TraversalType& traversal,
                                  SessionStage& stage,
                                  OklSemaCtx& sema,
                                  DynTypedNode& node,
-                                 const std::set<const Attr*>& attrs) {
+                                 const std::vector<const Attr*>& attrs) {
     auto& am = stage.getAttrManager();
     if (attrs.empty()) {
         return am.handleSemaPre(stage, node, nullptr);
@@ -166,7 +176,7 @@ HandleResult runFromLeavesToRoot(TraversalType& traversal,
                                  SessionStage& stage,
                                  OklSemaCtx& sema,
                                  DynTypedNode& node,
-                                 const std::set<const Attr*>& attrs) {
+                                 const std::vector<const Attr*>& attrs) {
     auto& am = stage.getAttrManager();
     auto& transpilationAccumulator = stage.tryEmplaceUserCtx<TranspilationNodes>();
     auto* ki = sema.getParsingKernelInfo();
@@ -232,6 +242,20 @@ bool skipNode(SessionStage& s, const NodeType& n) {
     return false;
 }
 
+// Body of the function without OKL constructs has nothing to be handled by sema or backend
+template <typename NodeType>
+bool skipChildren(SessionStage& s, const NodeType& n, const std::vector<const Attr*>& attrs) {
+    if constexpr (std::is_same_v<NodeType, Decl>) {
+        const auto* func = dyn_cast<FunctionDecl>(&n);
+        if (!func || !func->doesThisDeclarationHaveABody() || !attrs.empty()) {
+            return false;
+        }
+        const auto& index = s.tryEmplaceUserCtx<OklAttrIndex>();
+        return !index.mayContainOkl(s.getCompiler().getSourceManager(), func->getSourceRange());
+    }
+    return false;
+}
+
 template <typename TraversalType, typename NodeType>
 bool traverseNode(TraversalType& traversal, SessionStage& stage, NodeType* node) {
     if (node == nullptr) {
@@ -262,7 +286,8 @@ bool traverseNode(TraversalType& traversal, SessionStage& stage, NodeType* node)
         }
 
         // dispatch the next node
-        if (!dispatchTraverseFunc(traversal, node)) {
+        if (!skipChildren(stage, *node, attrsResult.value()) &&
+            !dispatchTraverseFunc(traversal, node)) {
             return tl::make_unexpected(Error{});
         }
 
@@ -397,6 +422,14 @@ class TranspilationConsumer : public clang::ASTConsumer {
         }
     }
 
+    void HandleTagDeclDefinition(TagDecl* decl) override {
+        // local class gets implicit handlers, so its function can't be skipped in traversal
+        if (isa<CXXRecordDecl>(decl) && decl->getParentFunctionOrMethod()) {
+            auto& sm = _stage.getCompiler().getSourceManager();
+            _stage.tryEmplaceUserCtx<OklAttrIndex>().add(sm, decl, decl->getLocation());
+        }
+    }
+
     SessionStage& getSessionStage() { return _stage; }
 
    private:
@@ -0,0 +1,287 @@
+namespace okl_threads {
+namespace detail {
+// Half-open range of iteration indices
+struct Chunk {
+    long long begin;
+    long long end;
+};
+
+// Owner pops chunks from the front, thieves steal from the back
+struct WorkerQueue {
+    std::mutex lock;
+    std::deque<Chunk> chunks;
+
+    bool pop(Chunk& chunk) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (chunks.empty()) {
+            return false;
+        }
+        chunk = chunks.front();
+        chunks.pop_front();
+        return true;
+    }
+
+    bool steal(Chunk& chunk) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (chunks.empty()) {
+            return false;
+        }
+        chunk = chunks.back();
+        chunks.pop_back();
+        return true;
+    }
+};
+
+struct Task {
+    void* ctx = nullptr;
+    void (*call)(void*, long long, long long) = nullptr;
+};
+
+inline thread_local bool insideWorker = false;
+
+inline long long envOr(const char* name, long long fallback) {
+    const char* value = std::getenv(name);
+    if (!value || !*value) {
+        return fallback;
+    }
+    return std::atoll(value);
+}
+
+inline unsigned defaultNumThreads() {
+    auto n = envOr("OKL_NUM_THREADS", 0);
+    if (n > 0) {
+        return static_cast<unsigned>(n);
+    }
+    auto hw = std::thread::hardware_concurrency();
+    return hw ? hw : 1;
+}
+
+class Pool {
+   public:
+    static Pool& instance() {
+        static Pool pool;
+        return pool;
+    }
+
+    ~Pool() { stop(); }
+
+    void setNumThreads(unsigned n) {
+        std::lock_guard<std::mutex> guard(runLock);
+        stop();
+        start(n ? n : defaultNumThreads());
+    }
+
+    unsigned getNumThreads() {
+        std::lock_guard<std::mutex> guard(runLock);
+        return static_cast<unsigned>(queues.size());
+    }
+
+    void setGrain(long long value) { grain.store(value > 0 ? value : 0); }
+
+    long long getGrain() const { return grain.load(); }
+
+    void run(void* ctx, void (*call)(void*, long long, long long), long long size) {
+        if (size <= 0) {
+            return;
+        }
+        // Nested launches and single thread pools run inline
+        if (insideWorker) {
+            call(ctx, 0, size);
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(runLock);
+        auto nQueues = static_cast<long long>(queues.size());
+        if (nQueues <= 1) {
+            call(ctx, 0, size);
+            return;
+        }
+
+        auto chunkSize = grain.load();
+        if (!chunkSize) {
+            chunkSize = std::max(1LL, size / (nQueues * 8));
+        }
+        auto nChunks = (size + chunkSize - 1) / chunkSize;
+
+        // Task must be visible before any chunk of it can be popped
+        task = Task{ctx, call};
+        remaining.store(nChunks);
+        for (long long w = 0; w < nQueues; ++w) {
+            auto& queue = *queues[w];
+            std::lock_guard<std::mutex> queueGuard(queue.lock);
+            for (auto c = nChunks * w / nQueues; c < nChunks * (w + 1) / nQueues; ++c) {
+                queue.chunks.push_back(Chunk{c * chunkSize, std::min(size, (c + 1) * chunkSize)});
+            }
+        }
+        {
+            std::lock_guard<std::mutex> wakeGuard(wakeLock);
+            ++generation;
+        }
+        wake.notify_all();
+
+        insideWorker = true;
+        work(0);
+        insideWorker = false;
+
+        std::unique_lock<std::mutex> doneGuard(doneLock);
+        done.wait(doneGuard, [this] { return remaining.load() == 0; });
+    }
+
+   private:
+    Pool() {
+        setGrain(envOr("OKL_THREADS_GRAIN", 0));
+        start(defaultNumThreads());
+    }
+
+    void start(unsigned n) {
+        stopping = false;
+        queues.clear();
+        for (unsigned i = 0; i < n; ++i) {
+            queues.emplace_back(new WorkerQueue());
+        }
+        // Calling thread is the worker 0
+        for (unsigned i = 1; i < n; ++i) {
+            workers.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> wakeGuard(wakeLock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+    }
+
+    void workerLoop(size_t self) {
+        insideWorker = true;
+        size_t seen = 0;
+        {
+            std::lock_guard<std::mutex> wakeGuard(wakeLock);
+            seen = generation;
+        }
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> wakeGuard(wakeLock);
+                wake.wait(wakeGuard, [&] { return stopping || generation != seen; });
+                if (stopping) {
+                    return;
+                }
+                seen = generation;
+            }
+            work(self);
+        }
+    }
+
+    bool steal(size_t self, Chunk& chunk) {
+        auto n = queues.size();
+        for (size_t i = 1; i < n; ++i) {
+            if (queues[(self + i) % n]->steal(chunk)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Chunks are queued only before the workers are woken, so once every queue is empty the rest
+    // of the run is executed by other workers, and this one parks until the next run
+    void work(size_t self) {
+        Chunk chunk;
+        while (remaining.load() > 0) {
+            if (!queues[self]->pop(chunk) && !steal(self, chunk)) {
+                return;
+            }
+            task.call(task.ctx, chunk.begin, chunk.end);
+            if (remaining.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> doneGuard(doneLock);
+                done.notify_all();
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    Task task;
+    std::atomic<long long> remaining{0};
+    std::atomic<long long> grain{0};
+
+    std::mutex runLock;
+    std::mutex wakeLock;
+    std::condition_variable wake;
+    size_t generation = 0;
+    bool stopping = false;
+    std::mutex doneLock;
+    std::condition_variable done;
+};
+
+template <class T, class S, class F>
+inline void dispatch(T begin, long long size, S step, bool reverse, F& fn) {
+    struct Ctx {
+        T begin;
+        long long step;
+        F* fn;
+    } ctx{begin, reverse ? -static_cast<long long>(step) : static_cast<long long>(step), &fn};
+
+    Pool::instance().run(
+        &ctx,
+        [](void* p, long long first, long long last) {
+            auto& c = *static_cast<Ctx*>(p);
+            for (auto i = first; i < last; ++i) {
+                (*c.fn)(static_cast<T>(c.begin + i * c.step));
+            }
+        },
+        size);
+}
+}  // namespace detail
+
+// Runs fn(v) for v = begin; v < end; v += step
+template <class T, class S, class F>
+inline void parallel_for(T begin, T end, S step, F&& fn) {
+    if (!(begin < end) || !(step > 0)) {
+        return;
+    }
+    auto size = (static_cast<long long>(end - begin) + step - 1) / step;
+    detail::dispatch(begin, size, step, false, fn);
+}
+
+// Runs fn(v) for v = begin; v > end; v -= step
+template <class T, class S, class F>
+inline void parallel_for_reverse(T begin, T end, S step, F&& fn) {
+    if (!(begin > end) || !(step > 0)) {
+        return;
+    }
+    auto size = (static_cast<long long>(begin - end) + step - 1) / step;
+    detail::dispatch(begin, size, step, true, fn);
+}
+
+// Serializes `@atomic` blocks
+[[maybe_unused]]
+inline std::mutex& atomic_mutex() {
+    static std::mutex lock;
+    return lock;
+}
+}  // namespace okl_threads
+
+// Pool size and grain are read from OKL_NUM_THREADS and OKL_THREADS_GRAIN on first launch and can
+// be changed at run time. 0 restores the default: hardware concurrency / automatic grain.
+// Definitions are weak, so generated sources linked into one kernel library share them and the
+// pool. Every kernel library has a pool of its own.
+extern "C" __attribute__((weak)) void okl_threads_set_num_threads(int n) {
+    okl_threads::detail::Pool::instance().setNumThreads(n > 0 ? static_cast<unsigned>(n) : 0);
+}
+
+extern "C" __attribute__((weak)) int okl_threads_get_num_threads() {
+    return static_cast<int>(okl_threads::detail::Pool::instance().getNumThreads());
+}
+
+extern "C" __attribute__((weak)) void okl_threads_set_grain(long long grain) {
+    okl_threads::detail::Pool::instance().setGrain(grain);
+}
+
+extern "C" __attribute__((weak)) long long okl_threads_get_grain() {
+    return okl_threads::detail::Pool::instance().getGrain();
+}
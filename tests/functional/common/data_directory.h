@@ -7,6 +7,7 @@ namespace oklt::tests {
 struct DataRootHolder {
     std::filesystem::path dataRoot;
     std::filesystem::path suitePath;
+    std::filesystem::path executable;  ///< Test binary, rerun for isolated test cases.
     static DataRootHolder& instance();
 };
 }  // namespace oklt::tests
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <filesystem>
+
+namespace oklt::tests {
+/**
+ * @brief Transpiles one test case of the suite and writes the outputs as JSON into the file. Runs
+ * in a child process of the tests, so repeated transpilations get a fresh address space layout.
+ * @return 0 on success, non-zero on failure.
+ */
+int runIsolatedCase(const std::filesystem::path& suite,
+                    size_t index,
+                    const std::filesystem::path& output);
+}  // namespace oklt::tests
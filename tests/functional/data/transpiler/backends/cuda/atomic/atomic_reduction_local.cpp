@@ -0,0 +1,10 @@
+@kernel void atomic_reduction_local(const int n, const float* in, float* out) {
+    @outer for (int i = 0; i < n; ++i) {
+        int k;
+        @inner for (int j = 0; j < 256; ++j) {
+            // Variable of @outer body is assigned per thread, so it stays a plain atomic
+            k = j % 16;
+            @atomic out[i * 16 + k] += in[i * 256 + j];
+        }
+    }
+}
@@ -0,0 +1,16 @@
+#include <cuda_runtime.h>
+
+extern "C" __global__ __launch_bounds__(256) void _occa_atomic_reduction_local_0(const int n,
+                                                                               const float* in,
+                                                                               float* out) {
+    {
+        int i = (0) + blockIdx.x;
+        int k;
+        {
+            int j = (0) + threadIdx.x;
+            // Variable of @outer body is assigned per thread, so it stays a plain atomic
+            k = j % 16;
+            atomicAdd(&(out[i * 16 + k]), in[i * 256 + j]);
+        }
+    }
+}
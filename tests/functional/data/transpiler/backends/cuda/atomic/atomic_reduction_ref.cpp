@@ -0,0 +1,36 @@
+#include <cuda_runtime.h>
+
+extern "C" __global__ __launch_bounds__(256) void _occa_atomic_reduction_0(const int n,
+                                                                         const float* in,
+                                                                         float* sum,
+                                                                         int* bins,
+                                                                         int* flags) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            {
+                float _occa_reduce = in[i * 256 + j];
+                for (int _occa_offset = 16; _occa_offset > 0; _occa_offset /= 2) {
+                    _occa_reduce =
+                        _occa_reduce + __shfl_down_sync(0xffffffff, _occa_reduce, _occa_offset);
+                }
+                if (threadIdx.x % 32 == 0) {
+                    atomicAdd(&(sum[i]), _occa_reduce);
+                }
+            }
+            {
+                int _occa_reduce = 1 << (j % 4);
+                for (int _occa_offset = 16; _occa_offset > 0; _occa_offset /= 2) {
+                    _occa_reduce =
+                        _occa_reduce | __shfl_down_sync(0xffffffff, _occa_reduce, _occa_offset);
+                }
+                if (threadIdx.x % 32 == 0) {
+                    atomicOr(&(*flags), _occa_reduce);
+                }
+            }
+            // Target depends on the thread, so it stays a plain atomic
+            atomicAdd(&(bins[j % 16]), 1);
+        }
+    }
+}
@@ -0,0 +1,14 @@
+// Statements between @inner loops take part in @shared memory hazards
+@kernel void outerStatement(const int n, float* out) {
+    @outer for (int i = 0; i < n; ++i) {
+        @shared float a[32];
+        @inner for (int j = 0; j < 32; ++j) {
+            a[j] = j;
+        }
+        // @outer level read of `a`, written by the previous loop
+        const float first = a[0];
+        @inner for (int j = 0; j < 32; ++j) {
+            out[i * 32 + j] = first;
+        }
+    }
+}
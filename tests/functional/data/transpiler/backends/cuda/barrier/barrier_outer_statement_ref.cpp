@@ -0,0 +1,20 @@
+#include <cuda_runtime.h>
+
+// Statements between @inner loops take part in @shared memory hazards
+extern "C" __global__ __launch_bounds__(32) void _occa_outerStatement_0(const int n, float* out) {
+    {
+        int i = (0) + blockIdx.x;
+        __shared__ float a[32];
+        {
+            int j = (0) + threadIdx.x;
+            a[j] = j;
+        }
+        __syncthreads();
+        // @outer level read of `a`, written by the previous loop
+        const float first = a[0];
+        {
+            int j = (0) + threadIdx.x;
+            out[i * 32 + j] = first;
+        }
+    }
+}
@@ -0,0 +1,30 @@
+// Barriers are inserted only between loops with conflicting @shared memory accesses
+@kernel void hazards(const int n, const float* in, float* out) {
+    @outer for (int i = 0; i < n; ++i) {
+        @shared float a[32];
+        @shared float b[32];
+        @inner for (int j = 0; j < 32; ++j) {
+            a[j] = in[i * 32 + j];
+        }
+        // write -> read of `a`
+        @inner for (int j = 0; j < 32; ++j) {
+            out[i * 32 + j] = a[31 - j];
+        }
+        // read -> read of `a`, elided
+        @inner for (int j = 0; j < 32; ++j) {
+            out[i * 32 + j] += a[j];
+        }
+        // different variables, elided
+        @inner for (int j = 0; j < 32; ++j) {
+            b[j] = out[i * 32 + j];
+        }
+        // no @shared memory
+        @inner for (int j = 0; j < 32; ++j) {
+            out[i * 32 + j] *= 2;
+        }
+        // write of `b` two loops before -> read
+        @inner for (int j = 0; j < 32; ++j) {
+            out[i * 32 + j] += b[31 - j];
+        }
+    }
+}
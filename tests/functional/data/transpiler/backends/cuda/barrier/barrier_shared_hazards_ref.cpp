@@ -0,0 +1,43 @@
+#include <cuda_runtime.h>
+
+// Barriers are inserted only between loops with conflicting @shared memory accesses
+extern "C" __global__ __launch_bounds__(32) void _occa_hazards_0(const int n,
+                                                                const float* in,
+                                                                float* out) {
+    {
+        int i = (0) + blockIdx.x;
+        __shared__ float a[32];
+        __shared__ float b[32];
+        {
+            int j = (0) + threadIdx.x;
+            a[j] = in[i * 32 + j];
+        }
+        __syncthreads();
+        // write -> read of `a`
+        {
+            int j = (0) + threadIdx.x;
+            out[i * 32 + j] = a[31 - j];
+        }
+        // read -> read of `a`, elided
+        {
+            int j = (0) + threadIdx.x;
+            out[i * 32 + j] += a[j];
+        }
+        // different variables, elided
+        {
+            int j = (0) + threadIdx.x;
+            b[j] = out[i * 32 + j];
+        }
+        // no @shared memory
+        {
+            int j = (0) + threadIdx.x;
+            out[i * 32 + j] *= 2;
+        }
+        __syncthreads();
+        // write of `b` two loops before -> read
+        {
+            int j = (0) + threadIdx.x;
+            out[i * 32 + j] += b[31 - j];
+        }
+    }
+}
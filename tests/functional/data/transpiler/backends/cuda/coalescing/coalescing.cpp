@@ -0,0 +1,26 @@
+// Consecutive threads along x axis access consecutive, strided and data dependent elements
+@kernel void access(const int n, const int* idx, const float* in, float* out) {
+    @outer for (int b = 0; b < n; ++b) {
+        @inner for (int y = 0; y < 8; ++y) {
+            @inner for (int x = 0; x < 32; ++x) {
+                int row = b * 8 + y;
+                out[row * 32 + x] = in[row * 32 + x];
+                out[x * n + row] = in[x * 32 + row];
+                out[idx[x]] = in[n];
+            }
+        }
+    }
+}
+
+// The slowest dimension of @dimOrder view is iterated by x axis
+@kernel void transpose(const int n,
+                       const float* in @dim(32, 8) @dimOrder(1, 0),
+                       float* out @dim(32, 8)) {
+    @outer for (int b = 0; b < n; ++b) {
+        @inner for (int y = 0; y < 8; ++y) {
+            @inner for (int x = 0; x < 32; ++x) {
+                out(x, y) = in(x, y);
+            }
+        }
+    }
+}
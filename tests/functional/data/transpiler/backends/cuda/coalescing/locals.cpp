@@ -0,0 +1,19 @@
+// Locals set once by the initializer and loop counters with a uniform step are followed, other
+// locals make the access scattered
+@kernel void locals(const int n, const float* in, float* out) {
+    @outer for (int b = 0; b < n; ++b) {
+        @inner for (int x = 0; x < 32; ++x) {
+            int i = b * 32 + x;
+            int k;
+            k = x;
+            int m = x;
+            m = b;
+            float sum = in[i];
+            for (int j = 1; j < 4; ++j) {
+                sum += in[j * n + i];
+            }
+            out[k] = sum + in[m];
+            out[x * 2] = sum;
+        }
+    }
+}
@@ -0,0 +1,31 @@
+#include "helpers.h"
+struct Point {
+    float x, y;
+};
+struct Unused {
+    int a;
+    int b;
+    float c;
+};
+const int UNUSED_SIZE = 16;
+typedef double unused_t;
+static float unusedHelper(float a) {
+    return a * UNUSED_SIZE;
+}
+enum Mode { FAST, SLOW };
+const int SIZE = 32;
+typedef float real_t;
+template <typename T>
+T square(T a) {
+    return a * a;
+}
+float norm(const Point& p) {
+    return square(p.x) + square(p.y);
+}
+@kernel void kern(const Point* points, real_t* out) {
+    @outer for (int i = 0; i < SIZE; ++i) {
+        @inner for (int j = 0; j < 1; ++j) {
+            out[i] = scale(norm(points[i])) * (FAST + 1);
+        }
+    }
+}
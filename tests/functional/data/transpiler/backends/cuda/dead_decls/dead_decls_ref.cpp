@@ -0,0 +1,20 @@
+#include <cuda_runtime.h>
+__device__ float scale(float a) { return 2 * a; }
+struct Point {
+  float x, y;
+};
+enum Mode { FAST, SLOW };
+__constant__ int SIZE = 32;
+typedef float real_t;
+template <typename T> __device__ T square(T a) { return a * a; }
+__device__ float norm(const Point &p) { return square(p.x) + square(p.y); }
+extern "C" __global__ __launch_bounds__(1) void _occa_kern_0(const Point *points,
+                                                            real_t *out) {
+  {
+    int i = (0) + blockIdx.x;
+    {
+      int j = (0) + threadIdx.x;
+      out[i] = scale(norm(points[i])) * (FAST + 1);
+    }
+  }
+}
@@ -0,0 +1,12 @@
+#pragma once
+float scale(float a) {
+    return 2 * a;
+}
+struct HeaderUnused {
+    int a;
+    int b;
+    int c;
+};
+float headerUnused(float a) {
+    return a + 1;
+}
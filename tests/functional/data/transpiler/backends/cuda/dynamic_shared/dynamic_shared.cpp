@@ -0,0 +1,36 @@
+// All @shared variables of the kernel are packed into one dynamic shared buffer
+@kernel void rowSums(const int n, const int rows, const float* in, float* out) {
+    @outer for (int i = 0; i < n; ++i) {
+        @shared char flags[3];
+        @shared float tile[rows][32];
+        @shared double acc[16];
+        @inner for (int j = 0; j < 32; ++j) {
+            for (int r = 0; r < rows; ++r) {
+                tile[r][j] = in[(i * rows + r) * 32 + j];
+            }
+            flags[j % 3] = 1;
+            acc[j % 16] = tile[0][j];
+        }
+        @inner for (int j = 0; j < 32; ++j) {
+            out[i * 32 + j] = acc[j % 16] + flags[j % 3];
+        }
+    }
+}
+
+// Every kernel split gets its own layout
+@kernel void twoLoops(const int n, float* out) {
+    @outer for (int i = 0; i < n; ++i) {
+        @shared float shm[64];
+        @inner for (int j = 0; j < 64; ++j) {
+            shm[j] = j;
+            out[i * 64 + j] = shm[63 - j];
+        }
+    }
+
+    @outer for (int i = 0; i < n; ++i) {
+        @shared int counter;
+        @inner for (int j = 0; j < 64; ++j) {
+            counter = j;
+        }
+    }
+}
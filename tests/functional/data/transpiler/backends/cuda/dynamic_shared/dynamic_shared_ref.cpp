@@ -0,0 +1,54 @@
+#include <cuda_runtime.h>
+// All @shared variables of the kernel are packed into one dynamic shared buffer
+extern "C" __global__ __launch_bounds__(32) void _occa_rowSums_0(const int n,
+                                                                 const int rows,
+                                                                 const float* in,
+                                                                 float* out) {
+    extern __shared__ __align__(16) unsigned char _occa_shared_mem[];
+    {
+        int i = (0) + blockIdx.x;
+        char* flags = reinterpret_cast<char*>(_occa_shared_mem + 0);
+        float(*tile)[32] = reinterpret_cast<float(*)[32]>(_occa_shared_mem + 4);
+        double* acc =
+            reinterpret_cast<double*>(_occa_shared_mem + ((4 + (rows) * 128) + 7) / 8 * 8);
+        {
+            int j = (0) + threadIdx.x;
+            for (int r = 0; r < rows; ++r) {
+                tile[r][j] = in[(i * rows + r) * 32 + j];
+            }
+            flags[j % 3] = 1;
+            acc[j % 16] = tile[0][j];
+        }
+        __syncthreads();
+        {
+            int j = (0) + threadIdx.x;
+            out[i * 32 + j] = acc[j % 16] + flags[j % 3];
+        }
+    }
+}
+
+// Every kernel split gets its own layout
+extern "C" __global__ __launch_bounds__(64) void _occa_twoLoops_0(const int n, float* out) {
+    extern __shared__ __align__(16) unsigned char _occa_shared_mem[];
+    {
+        int i = (0) + blockIdx.x;
+        float* shm = reinterpret_cast<float*>(_occa_shared_mem + 0);
+        {
+            int j = (0) + threadIdx.x;
+            shm[j] = j;
+            out[i * 64 + j] = shm[63 - j];
+        }
+    }
+}
+
+extern "C" __global__ __launch_bounds__(64) void _occa_twoLoops_1(const int n, float* out) {
+    extern __shared__ __align__(16) unsigned char _occa_shared_mem[];
+    {
+        int i = (0) + blockIdx.x;
+        int& counter = *reinterpret_cast<int*>(_occa_shared_mem + 0);
+        {
+            int j = (0) + threadIdx.x;
+            counter = j;
+        }
+    }
+}
@@ -0,0 +1,10 @@
+@kernel void localExtent(const int n, float* out) {
+    @outer for (int i = 0; i < n; ++i) {
+        int rows = n / 2;
+        @shared float tile[rows][32];
+        @inner for (int j = 0; j < 32; ++j) {
+            tile[0][j] = j;
+            out[i * 32 + j] = tile[0][j];
+        }
+    }
+}
@@ -0,0 +1,10 @@
+@kernel void multiDeclarator(const int n, float* out) {
+    @outer for (int i = 0; i < n; ++i) {
+        @shared float a[32], b[32];
+        @inner for (int j = 0; j < 32; ++j) {
+            a[j] = j;
+            b[j] = 2 * j;
+            out[i * 32 + j] = a[31 - j] + b[j];
+        }
+    }
+}
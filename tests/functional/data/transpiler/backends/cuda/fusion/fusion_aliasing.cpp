@@ -0,0 +1,42 @@
+// Arguments can overlap, so a write of `a` can be read through `b` by another block
+@kernel void aliased(const int n, float* a, float* b) {
+    @outer for (int i = 0; i < n; ++i) {
+        @inner for (int j = 0; j < 32; ++j) {
+            a[i * 32 + j] = j;
+        }
+    }
+    @outer for (int i = 0; i < n; ++i) {
+        @inner for (int j = 0; j < 32; ++j) {
+            b[i * 32 + j] = 2 * b[i * 32 + j];
+        }
+    }
+}
+
+// Restrict arguments never overlap
+@kernel void restricted(const int n, float* a @restrict, float* b @restrict) {
+    @outer for (int i = 0; i < n; ++i) {
+        @inner for (int j = 0; j < 32; ++j) {
+            a[i * 32 + j] = j;
+        }
+    }
+    @outer for (int i = 0; i < n; ++i) {
+        @inner for (int j = 0; j < 32; ++j) {
+            b[i * 32 + j] = 2 * b[i * 32 + j];
+        }
+    }
+}
+
+// Pointer to const can still point to the written buffer, e.g. for in-place use with `in == out`,
+// and the second loop reads elements of the next block
+@kernel void constInput(const int n, const float* in, float* out) {
+    @outer for (int i = 0; i < n; ++i) {
+        @inner for (int j = 0; j < 32; ++j) {
+            out[i * 32 + j] = j;
+        }
+    }
+    @outer for (int i = 0; i < n; ++i) {
+        @inner for (int j = 0; j < 32; ++j) {
+            out[i * 32 + j] += in[(i + 1) * 32 + j];
+        }
+    }
+}
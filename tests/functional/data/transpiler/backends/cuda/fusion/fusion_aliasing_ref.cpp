@@ -0,0 +1,68 @@
+#include <cuda_runtime.h>
+// Arguments can overlap, so a write of `a` can be read through `b` by another block
+extern "C" __global__ __launch_bounds__(32) void _occa_aliased_0(const int n, float* a, float* b) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            a[i * 32 + j] = j;
+        }
+    }
+}
+
+extern "C" __global__ __launch_bounds__(32) void _occa_aliased_1(const int n, float* a, float* b) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            b[i * 32 + j] = 2 * b[i * 32 + j];
+        }
+    }
+}
+
+// Restrict arguments never overlap
+extern "C" __global__ __launch_bounds__(32) void _occa_restricted_0(const int n,
+                                                                   float* __restrict__ a,
+                                                                   float* __restrict__ b) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            a[i * 32 + j] = j;
+        }
+    }
+    __syncthreads();
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            b[i * 32 + j] = 2 * b[i * 32 + j];
+        }
+    }
+}
+
+// Pointer to const can still point to the written buffer, e.g. for in-place use with `in == out`,
+// and the second loop reads elements of the next block
+extern "C" __global__ __launch_bounds__(32) void _occa_constInput_0(const int n,
+                                                                   const float* in,
+                                                                   float* out) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            out[i * 32 + j] = j;
+        }
+    }
+}
+
+extern "C" __global__ __launch_bounds__(32) void _occa_constInput_1(const int n,
+                                                                   const float* in,
+                                                                   float* out) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            out[i * 32 + j] += in[(i + 1) * 32 + j];
+        }
+    }
+}
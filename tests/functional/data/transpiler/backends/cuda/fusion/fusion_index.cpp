@@ -0,0 +1,13 @@
+// Block `b + 1` reads elements written by block `b`, even though both loops use the same index
+@kernel void overlapping(const int n, float* tmp) {
+    @outer for (int b = 0; b < n; ++b) {
+        @inner for (int j = 0; j < 32; ++j) {
+            tmp[b + j] = j;
+        }
+    }
+    @outer for (int b = 0; b < n; ++b) {
+        @inner for (int j = 0; j < 32; ++j) {
+            tmp[b + j] = 2 * tmp[b + j];
+        }
+    }
+}
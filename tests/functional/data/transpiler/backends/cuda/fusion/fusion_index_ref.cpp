@@ -0,0 +1,21 @@
+#include <cuda_runtime.h>
+// Block `b + 1` reads elements written by block `b`, even though both loops use the same index
+extern "C" __global__ __launch_bounds__(32) void _occa_overlapping_0(const int n, float* tmp) {
+    {
+        int b = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            tmp[b + j] = j;
+        }
+    }
+}
+
+extern "C" __global__ __launch_bounds__(32) void _occa_overlapping_1(const int n, float* tmp) {
+    {
+        int b = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            tmp[b + j] = 2 * tmp[b + j];
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#include <cuda_runtime.h>
+// The first two loops exchange data only inside the block and are fused into one kernel.
+// The last loop reads elements written by other blocks, so it gets a kernel of its own.
+extern "C" __global__ __launch_bounds__(32) void _occa_phases_0(const int n,
+                                                                const float* in,
+                                                                float* tmp,
+                                                                float* out) {
+    {
+        int b = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            tmp[b * 32 + j] = 2 * j;
+        }
+    }
+    __syncthreads();
+    {
+        int b = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            tmp[b * 32 + j] = tmp[b * 32 + j] + 1;
+        }
+    }
+}
+
+extern "C" __global__ __launch_bounds__(32) void _occa_phases_1(const int n,
+                                                                const float* in,
+                                                                float* tmp,
+                                                                float* out) {
+    {
+        int b = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            out[b * 32 + j] += tmp[j] * in[b * 32 + j];
+        }
+    }
+}
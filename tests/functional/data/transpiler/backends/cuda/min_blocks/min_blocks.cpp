@@ -0,0 +1,22 @@
+@kernel void scale(const int n, const float a, float* y) {
+    @outer for (int i = 0; i < n; ++i; @min_blocks(4)) {
+        @shared float tile[256];
+        @exclusive float acc[2];
+        @inner for (int j = 0; j < 256; ++j) {
+            tile[j] = y[i * 256 + j];
+            acc[0] = a * tile[j];
+        }
+        @inner for (int j = 0; j < 256; ++j) {
+            y[i * 256 + j] = acc[0] + tile[255 - j];
+        }
+    }
+}
+
+// Hint is dropped when the number of threads per block is unknown
+@kernel void fill(const int n, float* y) {
+    @outer for (int i = 0; i < n; ++i; @min_blocks(2)) {
+        @inner for (int j = 0; j < n; ++j) {
+            y[i * n + j] = 0;
+        }
+    }
+}
@@ -0,0 +1,7 @@
+@kernel void scale(const int n, float* y) {
+    @outer for (int i = 0; i < n; ++i) {
+        @inner for (int j = 0; j < 256; ++j; @min_blocks(4)) {
+            y[i * 256 + j] = 0;
+        }
+    }
+}
@@ -0,0 +1,32 @@
+#include <cuda_runtime.h>
+
+extern "C" __global__ __launch_bounds__(256, 4) void _occa_scale_0(const int n,
+                                                                  const float a,
+                                                                  float* y) {
+    {
+        int i = (0) + blockIdx.x;
+        __shared__ float tile[256];
+        float acc[2];
+        {
+            int j = (0) + threadIdx.x;
+            tile[j] = y[i * 256 + j];
+            acc[0] = a * tile[j];
+        }
+        __syncthreads();
+        {
+            int j = (0) + threadIdx.x;
+            y[i * 256 + j] = acc[0] + tile[255 - j];
+        }
+    }
+}
+
+// Hint is dropped when the number of threads per block is unknown
+extern "C" __global__ void _occa_fill_0(const int n, float* y) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            y[i * n + j] = 0;
+        }
+    }
+}
@@ -0,0 +1,31 @@
+@kernel void pipelined(const int blocks, const float* a, float* out) {
+    for (int b = 0; b < blocks; ++b; @outer) {
+        @shared float tile[64];
+        for (int t = 0; t < 16; ++t) {
+            @pipeline(3) for (int j = 0; j < 64; ++j; @inner) {
+                tile[j] = a[(b * 16 + t) * 64 + j];
+            }
+            for (int j = 0; j < 64; ++j; @inner) {
+                out[(b * 16 + t) * 64 + j] = tile[63 - j];
+            }
+        }
+    }
+}
+
+// Tile is used outside of the sequential loop, copies stay synchronous
+@kernel void not_pipelined(const int blocks, const float* a, float* out) {
+    for (int b = 0; b < blocks; ++b; @outer) {
+        @shared float tile[64];
+        for (int t = 0; t < 16; ++t) {
+            @pipeline for (int j = 0; j < 64; ++j; @inner) {
+                tile[j] = a[(b * 16 + t) * 64 + j];
+            }
+            for (int j = 0; j < 64; ++j; @inner) {
+                out[(b * 16 + t) * 64 + j] = tile[63 - j];
+            }
+        }
+        for (int j = 0; j < 64; ++j; @inner) {
+            out[b * 64 + j] += tile[j];
+        }
+    }
+}
@@ -0,0 +1,111 @@
+#include <cuda_runtime.h>
+#include <cuda_pipeline_primitives.h>
+
+namespace {
+// Math functions
+
+// Single precision
+[[maybe_unused]] inline __device__ float okl_exp10f(float x) { return exp10f(x); }
+
+// Warp Shuffle Functions
+template <class T>
+inline __device__ T okl_shfl_sync(unsigned mask, T var, int srcLane,
+                                  int width = warpSize) {
+  return __shfl_sync(mask, var, srcLane, width);
+}
+
+template <class T>
+inline __device__ T okl_shfl_up_sync(unsigned mask, T var, unsigned int delta,
+                                     int width = warpSize) {
+  return __shfl_up_sync(mask, var, delta, width);
+}
+
+template <class T>
+inline __device__ T okl_shfl_down_sync(unsigned mask, T var, unsigned int delta,
+                                       int width = warpSize) {
+  return __shfl_down_sync(mask, var, delta, width);
+}
+
+template <class T>
+inline __device__ T okl_shfl_xor_sync(unsigned mask, T var, int laneMask,
+                                      int width = warpSize) {
+  return __shfl_xor_sync(mask, laneMask, width);
+}
+
+// Pipeline Primitives Interface
+[[maybe_unused]] _CUDA_PIPELINE_STATIC_QUALIFIER void
+okl_memcpy_async(void *__restrict__ dst_shared,
+                      const void *__restrict__ src_global,
+                      size_t size_and_align, size_t zfill = 0) {
+  __pipeline_memcpy_async(dst_shared, src_global, size_and_align);
+}
+
+[[maybe_unused]] _CUDA_PIPELINE_STATIC_QUALIFIER void okl_pipeline_commit() {
+   __pipeline_commit();
+}
+
+[[maybe_unused]] _CUDA_PIPELINE_STATIC_QUALIFIER void
+okl_pipeline_wait_prior(size_t N) { __pipeline_wait_prior(N); }
+} // namespace
+
+extern "C" __global__ __launch_bounds__(64) void _occa_pipelined_0(const int blocks,
+                                                                  const float *a,
+                                                                  float *out) {
+  {
+    int b = (0) + blockIdx.x;
+    __shared__ float tile[3][64];
+    for (int _occa_pipeline_iter = (0); _occa_pipeline_iter < (16) + 2;
+         ++_occa_pipeline_iter) {
+      {
+        int t = _occa_pipeline_iter;
+        if (t < (16)) {
+          const int _occa_pipeline_stage = (t - (0)) % 3;
+          {
+            int j = (0) + threadIdx.x;
+            okl_memcpy_async(&tile[_occa_pipeline_stage][j],
+                             &(a[(b * 16 + t) * 64 + j]), sizeof(float));
+          }
+        }
+        okl_pipeline_commit();
+      }
+      okl_pipeline_wait_prior(2);
+      __syncthreads();
+      {
+        int t = _occa_pipeline_iter - 2;
+        if (t >= (0)) {
+          const int _occa_pipeline_stage = (t - (0)) % 3;
+          {
+            int j = (0) + threadIdx.x;
+            out[(b * 16 + t) * 64 + j] = tile[_occa_pipeline_stage][63 - j];
+          }
+          __syncthreads();
+        }
+      }
+    }
+  }
+}
+
+// Tile is used outside of the sequential loop, copies stay synchronous
+extern "C" __global__ __launch_bounds__(64) void _occa_not_pipelined_0(
+    const int blocks, const float *a, float *out) {
+  {
+    int b = (0) + blockIdx.x;
+    __shared__ float tile[64];
+    for (int t = 0; t < 16; ++t) {
+      {
+        int j = (0) + threadIdx.x;
+        tile[j] = a[(b * 16 + t) * 64 + j];
+      }
+      __syncthreads();
+      {
+        int j = (0) + threadIdx.x;
+        out[(b * 16 + t) * 64 + j] = tile[63 - j];
+      }
+      __syncthreads();
+    }
+    {
+      int j = (0) + threadIdx.x;
+      out[b * 64 + j] += tile[j];
+    }
+  }
+}
@@ -0,0 +1,18 @@
+#include <cuda_runtime.h>
+
+// `in` and `coef` are only read, `out` is written and `alias` escapes into a local pointer
+extern "C" __global__ __launch_bounds__(64) void _occa_read_only_0(const int n,
+                                                                  const float* __restrict__ in,
+                                                                  const float* __restrict__ coef,
+                                                                  float* out,
+                                                                  float* alias,
+                                                                  float* keep) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            float* row = alias + i * 64;
+            out[i * 64 + j] = in[i * 64 + j] * *(coef + j) + row[j] + keep[j];
+        }
+    }
+}
@@ -0,0 +1,55 @@
+// Transposed access: threads along x read a column of the tile
+@kernel void transpose(const int n, const float* in, float* out) {
+    @outer for (int b = 0; b < n; ++b) {
+        @shared float tile[32][32];
+        @inner for (int y = 0; y < 32; ++y) {
+            @inner for (int x = 0; x < 32; ++x) {
+                tile[y][x] = in[(b * 32 + y) * 32 + x];
+            }
+        }
+        @inner for (int y = 0; y < 32; ++y) {
+            @inner for (int x = 0; x < 32; ++x) {
+                out[(b * 32 + y) * 32 + x] = tile[x][y];
+            }
+        }
+    }
+}
+
+// Padding is forced or disabled by the attribute, row-wise access is kept as is
+@kernel void modes(const int n, float* out) {
+    @outer for (int b = 0; b < n; ++b) {
+        @shared(nopad) float cols[32][32];
+        @shared(pad) double acc[8][16];
+        @shared float rows[32][32];
+        @inner for (int y = 0; y < 32; ++y) {
+            @inner for (int x = 0; x < 32; ++x) {
+                cols[x][y] = x;
+                acc[y % 8][x % 16] = y;
+                rows[y][x] = cols[y][x] + acc[y % 8][x % 16];
+            }
+        }
+        @inner for (int y = 0; y < 32; ++y) {
+            @inner for (int x = 0; x < 32; ++x) {
+                out[(b * 32 + y) * 32 + x] = rows[y][x];
+            }
+        }
+    }
+}
+
+// Address of an element is taken, the layout is observed and the tile is kept as is
+@kernel void addressTaken(const int n, float* out) {
+    @outer for (int b = 0; b < n; ++b) {
+        @shared float tile[32][32];
+        @inner for (int y = 0; y < 32; ++y) {
+            @inner for (int x = 0; x < 32; ++x) {
+                tile[y][x] = y;
+            }
+        }
+        @inner for (int y = 0; y < 32; ++y) {
+            @inner for (int x = 0; x < 32; ++x) {
+                const float* row = &tile[x][0];
+                out[(b * 32 + y) * 32 + x] = row[y];
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#include <cuda_runtime.h>
+// Transposed access: threads along x read a column of the tile
+extern "C" __global__ __launch_bounds__(1024) void _occa_transpose_0(const int n,
+                                                                     const float* in,
+                                                                     float* out) {
+    {
+        int b = (0) + blockIdx.x;
+        __shared__ float tile[32][33];
+        {
+            int y = (0) + threadIdx.y;
+            {
+                int x = (0) + threadIdx.x;
+                tile[y][x] = in[(b * 32 + y) * 32 + x];
+            }
+        }
+        __syncthreads();
+        {
+            int y = (0) + threadIdx.y;
+            {
+                int x = (0) + threadIdx.x;
+                out[(b * 32 + y) * 32 + x] = tile[x][y];
+            }
+        }
+    }
+}
+
+// Padding is forced or disabled by the attribute, row-wise access is kept as is
+extern "C" __global__ __launch_bounds__(1024) void _occa_modes_0(const int n, float* out) {
+    {
+        int b = (0) + blockIdx.x;
+        __shared__ float cols[32][32];
+        __shared__ double acc[8][17];
+        __shared__ float rows[32][32];
+        {
+            int y = (0) + threadIdx.y;
+            {
+                int x = (0) + threadIdx.x;
+                cols[x][y] = x;
+                acc[y % 8][x % 16] = y;
+                rows[y][x] = cols[y][x] + acc[y % 8][x % 16];
+            }
+        }
+        __syncthreads();
+        {
+            int y = (0) + threadIdx.y;
+            {
+                int x = (0) + threadIdx.x;
+                out[(b * 32 + y) * 32 + x] = rows[y][x];
+            }
+        }
+    }
+}
+
+// Address of an element is taken, the layout is observed and the tile is kept as is
+extern "C" __global__ __launch_bounds__(1024) void _occa_addressTaken_0(const int n, float* out) {
+    {
+        int b = (0) + blockIdx.x;
+        __shared__ float tile[32][32];
+        {
+            int y = (0) + threadIdx.y;
+            {
+                int x = (0) + threadIdx.x;
+                tile[y][x] = y;
+            }
+        }
+        __syncthreads();
+        {
+            int y = (0) + threadIdx.y;
+            {
+                int x = (0) + threadIdx.x;
+                const float* row = &tile[x][0];
+                out[(b * 32 + y) * 32 + x] = row[y];
+            }
+        }
+    }
+}
@@ -0,0 +1,17 @@
+// Loop bounds and tile sizes are constants of the program, so block sizes are known at compile time
+constexpr int p_Nq = 8;
+enum { BLOCK = 4 };
+
+@kernel void sizes(const int entries, float* out) {
+    @outer for (int e = 0; e < entries; ++e) {
+        @inner for (int j = 0; j <= p_Nq - 1; j += 2) {
+            out[e * p_Nq + j] = 0;
+        }
+    }
+    @outer for (int e = 0; e < entries; ++e) {
+        const int Np = p_Nq * BLOCK;
+        for (int i = 0; i < Np; ++i; @tile(BLOCK, @inner, @inner)) {
+            out[e * Np + i] = 1;
+        }
+    }
+}
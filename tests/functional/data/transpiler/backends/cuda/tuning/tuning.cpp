@@ -0,0 +1,8 @@
+// Block size is tuned at JIT time: each point of the grid gets a kernel with its own launch bounds
+@kernel void scale(const int BS, const float* in, float* out) {
+    @outer for (int b = 0; b < 16; ++b) {
+        @inner for (int i = 0; i < BS; ++i) {
+            out[b * BS + i] = 2 * in[b * BS + i];
+        }
+    }
+}
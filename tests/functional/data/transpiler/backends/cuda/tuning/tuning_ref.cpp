@@ -0,0 +1,37 @@
+#include <cuda_runtime.h>
+// Block size is tuned at JIT time: each point of the grid gets a kernel with its own launch bounds
+extern "C" __global__ void _occa_scale_0(const int BS, const float* in, float* out) {
+    {
+        int b = (0) + blockIdx.x;
+        {
+            int i = (0) + threadIdx.x;
+            out[b * BS + i] = 2 * in[b * BS + i];
+        }
+    }
+}
+
+extern "C" __global__ __launch_bounds__(64) void _occa_scale_0_v0(const int,
+                                                                  const float* in,
+                                                                  float* out) {
+    constexpr int BS = 64;
+    {
+        int b = (0) + blockIdx.x;
+        {
+            int i = (0) + threadIdx.x;
+            out[b * BS + i] = 2 * in[b * BS + i];
+        }
+    }
+}
+
+extern "C" __global__ __launch_bounds__(128) void _occa_scale_0_v1(const int,
+                                                                   const float* in,
+                                                                   float* out) {
+    constexpr int BS = 128;
+    {
+        int b = (0) + blockIdx.x;
+        {
+            int i = (0) + threadIdx.x;
+            out[b * BS + i] = 2 * in[b * BS + i];
+        }
+    }
+}
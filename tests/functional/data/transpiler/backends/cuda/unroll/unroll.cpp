@@ -0,0 +1,28 @@
+@kernel void unrolled(const int n, const float* a, float* out) {
+    for (int b = 0; b < n; ++b; @outer) {
+        for (int i = 0; i < 64; ++i; @inner) {
+            float sum = 0;
+            @unroll(4) for (int k = 0; k < 16; ++k) {
+                sum += a[(b * 64 + i) * 16 + k];
+            }
+            @unroll for (int k = 0; k < 4; ++k) {
+                sum *= a[k];
+            }
+            @unroll(expand) for (int k = 0; k < 3; ++k) {
+                out[(b * 64 + i) * 3 + k] = sum + k;
+            }
+        }
+    }
+}
+
+// Loop variable is modified in the body, expansion falls back to the pragma
+@kernel void not_expanded(const int n, float* out) {
+    for (int b = 0; b < n; ++b; @outer) {
+        for (int i = 0; i < 64; ++i; @inner) {
+            @unroll(expand) for (int k = 0; k < 8; ++k) {
+                out[b * 64 + i] += k;
+                k += out[b * 64 + i] > 1;
+            }
+        }
+    }
+}
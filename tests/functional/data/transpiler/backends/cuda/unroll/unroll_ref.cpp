@@ -0,0 +1,57 @@
+#include <cuda_runtime.h>
+
+extern "C" __global__ __launch_bounds__(64) void _occa_unrolled_0(const int n,
+                                                                 const float *a,
+                                                                 float *out) {
+  {
+    int b = (0) + blockIdx.x;
+    {
+      int i = (0) + threadIdx.x;
+      float sum = 0;
+#pragma unroll 4
+      for (int k = 0; k < 16; ++k) {
+        sum += a[(b * 64 + i) * 16 + k];
+      }
+#pragma unroll
+      for (int k = 0; k < 4; ++k) {
+        sum *= a[k];
+      }
+      {
+        {
+          int k = 0;
+          {
+            out[(b * 64 + i) * 3 + k] = sum + k;
+          }
+        }
+        {
+          int k = 1;
+          {
+            out[(b * 64 + i) * 3 + k] = sum + k;
+          }
+        }
+        {
+          int k = 2;
+          {
+            out[(b * 64 + i) * 3 + k] = sum + k;
+          }
+        }
+      }
+    }
+  }
+}
+
+// Loop variable is modified in the body, expansion falls back to the pragma
+extern "C" __global__ __launch_bounds__(64) void _occa_not_expanded_0(const int n,
+                                                                     float *out) {
+  {
+    int b = (0) + blockIdx.x;
+    {
+      int i = (0) + threadIdx.x;
+#pragma unroll
+      for (int k = 0; k < 8; ++k) {
+        out[b * 64 + i] += k;
+        k += out[b * 64 + i] > 1;
+      }
+    }
+  }
+}
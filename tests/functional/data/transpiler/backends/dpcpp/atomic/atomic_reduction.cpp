@@ -0,0 +1,10 @@
+@kernel void atomic_reduction(const int n, const float* in, float* sum, int* bins, int* flags) {
+    @outer for (int i = 0; i < n; ++i) {
+        @inner for (int j = 0; j < 256; ++j) {
+            @atomic sum[i] += in[i * 256 + j];
+            @atomic* flags |= 1 << (j % 4);
+            // Target depends on the thread, so it stays a plain atomic
+            @atomic bins[j % 16] += 1;
+        }
+    }
+}
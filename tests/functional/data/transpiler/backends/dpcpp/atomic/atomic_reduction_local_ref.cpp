@@ -0,0 +1,26 @@
+#include <CL/sycl.hpp>
+using namespace sycl;
+
+extern "C" [[sycl::reqd_work_group_size(1, 1, 256)]] void _occa_atomic_reduction_local_0(
+    sycl::queue* queue_,
+    sycl::nd_range<3>* range_,
+    const int n,
+    const float* in,
+    float* out) {
+    queue_->submit([&](sycl::handler& handler_) {
+        handler_.parallel_for(*range_, [=](sycl::nd_item<3> item_) {
+            {
+                int i = (0) + item_.get_group(2);
+                int k;
+                {
+                    int j = (0) + item.get_local_id(2);
+                    // Variable of @outer body is assigned per thread, so it stays a plain atomic
+                    k = j % 16;
+                    sycl::atomic_ref<float, sycl::memory_order::relaxed, sycl::memory_scope::device,
+                                     sycl::access::address_space::global_space>(
+                        out[i * 16 + k]) += in[i * 256 + j];
+                }
+            }
+        });
+    });
+}
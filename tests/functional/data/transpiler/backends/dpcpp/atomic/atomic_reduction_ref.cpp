@@ -0,0 +1,47 @@
+#include <CL/sycl.hpp>
+using namespace sycl;
+
+extern "C" [[sycl::reqd_work_group_size(1, 1, 256)]] void _occa_atomic_reduction_0(
+    sycl::queue* queue_,
+    sycl::nd_range<3>* range_,
+    const int n,
+    const float* in,
+    float* sum,
+    int* bins,
+    int* flags) {
+    queue_->submit([&](sycl::handler& handler_) {
+        handler_.parallel_for(*range_, [=](sycl::nd_item<3> item_) {
+            {
+                int i = (0) + item_.get_group(2);
+                {
+                    int j = (0) + item.get_local_id(2);
+                    {
+                        float _occa_reduce = sycl::reduce_over_group(
+                            item_.get_group(), static_cast<float>(in[i * 256 + j]),
+                            sycl::plus<float>());
+                        if (item_.get_local_linear_id() == 0) {
+                            sycl::atomic_ref<float, sycl::memory_order::relaxed,
+                                             sycl::memory_scope::device,
+                                             sycl::access::address_space::global_space>(sum[i]) +=
+                                _occa_reduce;
+                        }
+                    }
+                    {
+                        int _occa_reduce = sycl::reduce_over_group(
+                            item_.get_group(), static_cast<int>(1 << (j % 4)),
+                            sycl::bit_or<int>());
+                        if (item_.get_local_linear_id() == 0) {
+                            sycl::atomic_ref<int, sycl::memory_order::relaxed,
+                                             sycl::memory_scope::device,
+                                             sycl::access::address_space::global_space>(*flags) |=
+                                _occa_reduce;
+                        }
+                    }
+                    // Target depends on the thread, so it stays a plain atomic
+                    sycl::atomic_ref<int, sycl::memory_order::relaxed, sycl::memory_scope::device,
+                                     sycl::access::address_space::global_space>(bins[j % 16]) += 1;
+                }
+            }
+        });
+    });
+}
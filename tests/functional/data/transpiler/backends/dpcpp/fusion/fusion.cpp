@@ -0,0 +1,22 @@
+// Both loops exchange data only inside the work-group, so they are fused into one kernel and
+// their local memory is allocated by the same command group under distinct names
+@kernel void phases(const int n, float* tmp) {
+    @outer for (int b = 0; b < n; ++b) {
+        @shared float tile[32];
+        @inner for (int j = 0; j < 32; ++j) {
+            tile[j] = j;
+        }
+        @inner for (int j = 0; j < 32; ++j) {
+            tmp[b * 32 + j] = tile[31 - j];
+        }
+    }
+    @outer for (int b = 0; b < n; ++b) {
+        @shared float tile[32];
+        @inner for (int j = 0; j < 32; ++j) {
+            tile[j] = tmp[b * 32 + j];
+        }
+        @inner for (int j = 0; j < 32; ++j) {
+            tmp[b * 32 + j] = tile[31 - j] + 1;
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#include <CL/sycl.hpp>
+using namespace sycl;
+
+// Both loops exchange data only inside the work-group, so they are fused into one kernel and
+// their local memory is allocated by the same command group under distinct names
+extern "C" [[sycl::reqd_work_group_size(1, 1, 32)]] void _occa_phases_0(sycl::queue* queue_,
+                                                                       sycl::nd_range<3>* range_,
+                                                                       const int n,
+                                                                       float* tmp) {
+    queue_->submit([&](sycl::handler& handler_) {
+        sycl::local_accessor<float, 1> _occa_local_tile(sycl::range<1>(32), handler_);
+        sycl::local_accessor<float, 1> _occa_local_tile_1(sycl::range<1>(32), handler_);
+        handler_.parallel_for(*range_, [=](sycl::nd_item<3> item_) {
+            {
+                int b = (0) + item_.get_group(2);
+                auto& tile = *reinterpret_cast<float(*)[32]>(&_occa_local_tile[0]);
+                {
+                    int j = (0) + item.get_local_id(2);
+                    tile[j] = j;
+                }
+                item_.barrier(sycl::access::fence_space::local_space);
+                {
+                    int j = (0) + item.get_local_id(2);
+                    tmp[b * 32 + j] = tile[31 - j];
+                }
+            }
+            item_.barrier(sycl::access::fence_space::global_and_local);
+            {
+                int b = (0) + item_.get_group(2);
+                auto& tile = *reinterpret_cast<float(*)[32]>(&_occa_local_tile_1[0]);
+                {
+                    int j = (0) + item.get_local_id(2);
+                    tile[j] = tmp[b * 32 + j];
+                }
+                item_.barrier(sycl::access::fence_space::local_space);
+                {
+                    int j = (0) + item.get_local_id(2);
+                    tmp[b * 32 + j] = tile[31 - j] + 1;
+                }
+            }
+        });
+    });
+}
@@ -49,8 +49,8 @@ _occa_priority_issue_0(sycl::queue *queue_, sycl::nd_range<3> *range_) {
         {
           int j = (0) + item.get_local_id(2);
           sycl::atomic_ref<float, sycl::memory_order::relaxed,
-                           sycl::memory_scope::device,
-                           sycl::access::address_space::global_space>(
+                           sycl::memory_scope::work_group,
+                           sycl::access::address_space::local_space>(
               shm[i * j]) += 32;
         }
       }
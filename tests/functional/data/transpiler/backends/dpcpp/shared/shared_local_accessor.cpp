@@ -0,0 +1,20 @@
+@kernel void histogram(const int n, const int* keys, int* bins) {
+    @outer for (int i = 0; i < n; ++i) {
+        @shared int localBins[16];
+        @shared float tile[4][32];
+        @inner for (int j = 0; j < 32; ++j) {
+            if (j < 16) {
+                localBins[j] = 0;
+            }
+            tile[j % 4][j] = keys[i * 32 + j];
+        }
+        @inner for (int j = 0; j < 32; ++j) {
+            @atomic localBins[keys[i * 32 + j] % 16] += 1;
+        }
+        @inner for (int j = 0; j < 32; ++j) {
+            if (j < 16) {
+                @atomic bins[j] += localBins[j];
+            }
+        }
+    }
+}
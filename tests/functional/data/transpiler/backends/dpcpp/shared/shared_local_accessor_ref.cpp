@@ -0,0 +1,47 @@
+#include <CL/sycl.hpp>
+using namespace sycl;
+
+extern "C" [[sycl::reqd_work_group_size(1, 1, 32)]] void _occa_histogram_0(sycl::queue* queue_,
+                                                                          sycl::nd_range<3>* range_,
+                                                                          const int n,
+                                                                          const int* keys,
+                                                                          int* bins) {
+    queue_->submit([&](sycl::handler& handler_) {
+        sycl::local_accessor<int, 1> _occa_local_localBins(sycl::range<1>(16), handler_);
+        sycl::local_accessor<float, 1> _occa_local_tile(sycl::range<1>(128), handler_);
+        handler_.parallel_for(*range_, [=](sycl::nd_item<3> item_) {
+            {
+                int i = (0) + item_.get_group(2);
+                auto& localBins = *reinterpret_cast<int(*)[16]>(&_occa_local_localBins[0]);
+                auto& tile = *reinterpret_cast<float(*)[4][32]>(&_occa_local_tile[0]);
+                {
+                    int j = (0) + item.get_local_id(2);
+                    if (j < 16) {
+                        localBins[j] = 0;
+                    }
+                    tile[j % 4][j] = keys[i * 32 + j];
+                }
+                item_.barrier(sycl::access::fence_space::local_space);
+                {
+                    int j = (0) + item.get_local_id(2);
+                    sycl::atomic_ref<int,
+                                     sycl::memory_order::relaxed,
+                                     sycl::memory_scope::work_group,
+                                     sycl::access::address_space::local_space>(
+                        localBins[keys[i * 32 + j] % 16]) += 1;
+                }
+                item_.barrier(sycl::access::fence_space::local_space);
+                {
+                    int j = (0) + item.get_local_id(2);
+                    if (j < 16) {
+                        sycl::atomic_ref<int,
+                                         sycl::memory_order::relaxed,
+                                         sycl::memory_scope::device,
+                                         sycl::access::address_space::global_space>(bins[j]) +=
+                            localBins[j];
+                    }
+                }
+            }
+        });
+    });
+}
@@ -0,0 +1,8 @@
+// 8 blocks of one wavefront are at least 2 waves per each of 4 execution units
+@kernel void scale(const int n, const float a, float* y) {
+    @outer for (int i = 0; i < n; ++i; @min_blocks(8)) {
+        @inner for (int j = 0; j < 64; ++j) {
+            y[i * 64 + j] *= a;
+        }
+    }
+}
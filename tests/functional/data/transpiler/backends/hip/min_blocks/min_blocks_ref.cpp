@@ -0,0 +1,14 @@
+#include <hip/hip_runtime.h>
+
+// 8 blocks of one wavefront are at least 2 waves per each of 4 execution units
+extern "C" __global__ __launch_bounds__(64, 2) void _occa_scale_0(const int n,
+                                                                 const float a,
+                                                                 float* y) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            y[i * 64 + j] *= a;
+        }
+    }
+}
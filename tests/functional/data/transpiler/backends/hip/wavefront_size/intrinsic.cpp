@@ -0,0 +1,14 @@
+#include "okl_intrinsic.h"
+
+// Shuffles of okl_intrinsic.h span the whole wavefront by default
+@kernel void warpSum(const float* in, float* out) {
+    @outer for (int i = 0; i < 4; ++i) {
+        @inner for (int j = 0; j < 64; ++j) {
+            float v = in[i * 64 + j];
+            for (int m = 16; m > 0; m /= 2) {
+                v += okl_shfl_xor_sync(~0ull, v, m);
+            }
+            out[i * 64 + j] = v;
+        }
+    }
+}
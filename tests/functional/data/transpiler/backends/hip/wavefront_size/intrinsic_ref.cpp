@@ -0,0 +1,83 @@
+#include <hip/hip_runtime.h>
+
+#define OKL_WAVEFRONT_SIZE 64
+// Wavefront size the kernel is generated for, AMD GPUs run either 32 or 64 threads wavefronts
+#ifndef OKL_WAVEFRONT_SIZE
+#define OKL_WAVEFRONT_SIZE warpSize
+#endif
+
+namespace {
+
+//Single presicion
+[[maybe_unused]]
+inline __device__ float okl_exp10f (float x) {
+    return exp10f(x);
+}
+
+// Warp Shuffle Functions, mask has a bit per thread of the wavefront
+template<class T>
+inline __device__ T okl_shfl_sync(unsigned long long mask, T var, int srcLane, int width=OKL_WAVEFRONT_SIZE)
+{
+    return __shfl_sync(mask, var, srcLane, width);
+}
+
+template<class T>
+inline __device__ T okl_shfl_up_sync(unsigned long long mask, T var, unsigned int delta, int width=OKL_WAVEFRONT_SIZE)
+{
+    return __shfl_up_sync(mask, var, delta, width);
+}
+
+template<class T>
+inline __device__ T okl_shfl_down_sync(unsigned long long mask, T var, unsigned int delta, int width=OKL_WAVEFRONT_SIZE)
+{
+    return __shfl_down_sync(mask, var, delta, width);
+}
+
+template<class T>
+inline __device__
+    T okl_shfl_xor_sync(unsigned long long mask, T var, int laneMask, int width=OKL_WAVEFRONT_SIZE)
+{
+    return __shfl_xor_sync(mask, var, laneMask, width);
+}
+
+
+[[maybe_unused]]
+inline __device__ void okl_memcpy_async(void* dst_shared,
+                             const void* src_global,
+                             size_t size_and_align,
+                             size_t zfill=0)
+{
+    size_t i = 0;
+    // copy
+    for (; i < size_and_align - zfill; ++i) {
+        ((char*)dst_shared)[i] = ((char*)src_global)[i];
+    }
+    // zero-fill
+    for (; i < size_and_align; ++i) {
+        ((char*)dst_shared)[i] = 0;
+    }
+}
+
+[[maybe_unused]]
+inline __device__ void okl_pipeline_commit() {
+}
+
+[[maybe_unused]]
+inline __device__ void __pipeline_wait_prior(size_t N) {
+}
+}
+
+// Shuffles of okl_intrinsic.h span the whole wavefront by default
+extern "C" __global__ __launch_bounds__(64) void _occa_warpSum_0(const float* in, float* out) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            float v = in[i * 64 + j];
+            for (int m = 16; m > 0; m /= 2) {
+                v += okl_shfl_xor_sync(~0ull, v, m);
+            }
+            out[i * 64 + j] = v;
+        }
+    }
+}
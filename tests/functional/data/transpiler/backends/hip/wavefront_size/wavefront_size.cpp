@@ -0,0 +1,16 @@
+// 8 blocks of two 32 threads wavefronts are at least 4 waves per each of 4 execution units
+@kernel void scale(const int n, const float a, float* y) {
+    @outer for (int i = 0; i < n; ++i; @min_blocks(8)) {
+        @inner for (int j = 0; j < 64; ++j) {
+            y[i * 64 + j] *= a;
+        }
+    }
+}
+
+@kernel void sum(const int n, const float* y, float* total) {
+    @outer for (int i = 0; i < n; ++i) {
+        @inner for (int j = 0; j < 64; ++j) {
+            @atomic* total += y[i * 64 + j];
+        }
+    }
+}
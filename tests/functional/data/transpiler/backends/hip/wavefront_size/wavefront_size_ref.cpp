@@ -0,0 +1,34 @@
+#include <hip/hip_runtime.h>
+
+// 8 blocks of two 32 threads wavefronts are at least 4 waves per each of 4 execution units
+extern "C" __global__ __launch_bounds__(64, 4) void _occa_scale_0(const int n,
+                                                                 const float a,
+                                                                 float* y) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            y[i * 64 + j] *= a;
+        }
+    }
+}
+
+extern "C" __global__ __launch_bounds__(64) void _occa_sum_0(const int n,
+                                                            const float* y,
+                                                            float* total) {
+    {
+        int i = (0) + blockIdx.x;
+        {
+            int j = (0) + threadIdx.x;
+            {
+                float _occa_reduce = y[i * 64 + j];
+                for (int _occa_offset = 16; _occa_offset > 0; _occa_offset /= 2) {
+                    _occa_reduce = _occa_reduce + __shfl_down(_occa_reduce, _occa_offset);
+                }
+                if (threadIdx.x % 32 == 0) {
+                    atomicAdd(&(*total), _occa_reduce);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,12 @@
+// Order of the polynomial is bound at JIT time, so loop sizes are folded into launch bounds
+@kernel void interpolate(const int entries, const int N, const float* in, float* out) {
+    @outer for (int e = 0; e < entries; ++e) {
+        @inner for (int i = 0; i < N + 1; ++i) {
+            float sum = 0;
+            for (int j = 0; j < N + 1; ++j) {
+                sum += in[e * (N + 1) + j];
+            }
+            out[e * (N + 1) + i] = sum;
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#include <occa/core/kernel.hpp>
+
+// Order of the polynomial is bound at JIT time, so loop sizes are folded into launch bounds
+extern "C" void interpolate(occa::modeKernel_t** deviceKernels,
+                            const int& entries,
+                            const int& N,
+                            occa::modeMemory_t* in,
+                            occa::modeMemory_t* out) {
+    {
+        occa::dim outer, inner;
+        outer.dims = 1;
+        inner.dims = 1;
+        int e = 0;
+        outer[0] = (entries) - (0);
+        int i = 0;
+        inner[0] = (N + 1) - (0);
+        occa::kernel kernel(deviceKernels[0]);
+        kernel.setRunDims(outer, inner);
+        kernel(entries, in, out);
+    };
+}
@@ -0,0 +1,19 @@
+// The first two loops exchange data only inside the block and are fused into one kernel.
+// The last loop reads elements written by other blocks, so it gets a kernel of its own.
+@kernel void phases(const int n, const float* in, float* tmp, float* out) {
+    @outer for (int b = 0; b < n; ++b) {
+        @inner for (int j = 0; j < 32; ++j) {
+            tmp[b * 32 + j] = 2 * j;
+        }
+    }
+    @outer for (int b = 0; b < n; ++b) {
+        @inner for (int j = 0; j < 32; ++j) {
+            tmp[b * 32 + j] = tmp[b * 32 + j] + 1;
+        }
+    }
+    @outer for (int b = 0; b < n; ++b) {
+        @inner for (int j = 0; j < 32; ++j) {
+            out[b * 32 + j] += tmp[j] * in[b * 32 + j];
+        }
+    }
+}
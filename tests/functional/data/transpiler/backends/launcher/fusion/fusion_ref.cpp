@@ -0,0 +1,35 @@
+#include <occa/core/kernel.hpp>
+
+// The first two loops exchange data only inside the block and are fused into one kernel.
+// The last loop reads elements written by other blocks, so it gets a kernel of its own.
+extern "C" void phases(occa::modeKernel_t** deviceKernels,
+                       const int& n,
+                       occa::modeMemory_t* in,
+                       occa::modeMemory_t* tmp,
+                       occa::modeMemory_t* out) {
+    {
+        occa::dim outer, inner;
+        outer.dims = 1;
+        inner.dims = 1;
+        int b = 0;
+        outer[0] = (n) - (0);
+        int j = 0;
+        inner[0] = (32) - (0);
+        occa::kernel kernel(deviceKernels[0]);
+        kernel.setRunDims(outer, inner);
+        kernel(n, in, tmp, out);
+    };
+
+    {
+        occa::dim outer, inner;
+        outer.dims = 1;
+        inner.dims = 1;
+        int b = 0;
+        outer[0] = (n) - (0);
+        int j = 0;
+        inner[0] = (32) - (0);
+        occa::kernel kernel(deviceKernels[1]);
+        kernel.setRunDims(outer, inner);
+        kernel(n, in, tmp, out);
+    };
+}
@@ -0,0 +1,10 @@
+// Host backends run @inner loops sequentially, accesses are not reported
+@kernel void locals(const int n, const float* in, float* out) {
+    @outer for (int b = 0; b < n; ++b) {
+        @inner for (int x = 0; x < 32; ++x) {
+            int k;
+            k = x;
+            out[x * 2] = in[k];
+        }
+    }
+}
@@ -0,0 +1,26 @@
+@kernel void addVectors0(const int entries, const float* a, const float* b, float* ab) {
+    @outer for (int j = 0; j < entries; j += 16) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+}
+
+// Explicit @schedule is kept, no first-touch kernel for dynamic partition
+@kernel void addVectors1(const int entries, const float* a, const float* b, float* ab) {
+    @outer for (int j = 0; j < entries; j += 16; @schedule(dynamic, 4)) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+}
+
+// Range depends on the kernel local variable, no first-touch kernel
+@kernel void addVectors2(const int entries, const float* a, const float* b, float* ab) {
+    const int blocks = entries / 16;
+    @outer for (int j = blocks - 1; j >= 0; --j) {
+        @inner for (int i = 0; i < 16; ++i) {
+            ab[j * 16 + i] = a[j * 16 + i] + b[j * 16 + i];
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#include <cstring>
+
+extern "C" void addVectors0(const int& entries, const float* a, const float* b, float* ab) {
+#pragma omp parallel for schedule(static) proc_bind(spread)
+    for (int j = 0; j < entries; j += 16) {
+        for (int i = j; i < j + 16; ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+}
+
+extern "C" void _occa_first_touch_addVectors0(const int& entries,
+                                              const float* a,
+                                              const float* b,
+                                              float* ab,
+                                              void* _occa_buffer,
+                                              const size_t& _occa_bytes) {
+    const long long _occa_iters = ((entries) - (0) + (16) - 1) / (16);
+#pragma omp parallel for schedule(static) proc_bind(spread)
+    for (long long _occa_it = 0; _occa_it < _occa_iters; ++_occa_it) {
+        const size_t _occa_chunk = _occa_bytes / _occa_iters;
+        const size_t _occa_rest = _occa_bytes % _occa_iters;
+        const size_t _occa_index = _occa_it;
+        const size_t _occa_begin =
+            _occa_chunk * _occa_index + (_occa_index < _occa_rest ? _occa_index : _occa_rest);
+        const size_t _occa_end = _occa_begin + _occa_chunk + (_occa_index < _occa_rest ? 1 : 0);
+        std::memset(static_cast<char*>(_occa_buffer) + _occa_begin, 0, _occa_end - _occa_begin);
+    }
+}
+
+// Explicit @schedule is kept, no first-touch kernel for dynamic partition
+extern "C" void addVectors1(const int& entries, const float* a, const float* b, float* ab) {
+#pragma omp parallel for schedule(dynamic, 4)
+    for (int j = 0; j < entries; j += 16) {
+        for (int i = j; i < j + 16; ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+}
+
+// Range depends on the kernel local variable, no first-touch kernel
+extern "C" void addVectors2(const int& entries, const float* a, const float* b, float* ab) {
+    const int blocks = entries / 16;
+#pragma omp parallel for schedule(static) proc_bind(spread)
+    for (int j = blocks - 1; j >= 0; --j) {
+        for (int i = 0; i < 16; ++i) {
+            ab[j * 16 + i] = a[j * 16 + i] + b[j * 16 + i];
+        }
+    }
+}
@@ -0,0 +1,8 @@
+// Kind of the default policy chosen by the user is kept, no first-touch kernel for dynamic one
+@kernel void addVectors(const int entries, const float* a, const float* b, float* ab) {
+    @outer for (int j = 0; j < entries; j += 16) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+}
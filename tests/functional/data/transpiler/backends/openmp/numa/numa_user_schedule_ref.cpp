@@ -0,0 +1,9 @@
+// Kind of the default policy chosen by the user is kept, no first-touch kernel for dynamic one
+extern "C" void addVectors(const int& entries, const float* a, const float* b, float* ab) {
+#pragma omp parallel for schedule(dynamic) proc_bind(spread)
+    for (int j = 0; j < entries; j += 16) {
+        for (int i = j; i < j + 16; ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+}
@@ -0,0 +1,63 @@
+// Independent phases: barriers are skipped
+@kernel void independentPhases(const int entries,
+                               const float* a @restrict,
+                               float* b @restrict,
+                               float* c @restrict) {
+    @outer for (int j = 0; j < entries; j += 16) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            b[i] = a[i];
+        }
+    }
+    @outer for (int j = 0; j < entries; j += 16) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            c[i] = 2 * a[i];
+        }
+    }
+}
+
+// Second phase reads what the first one writes: barrier is kept
+@kernel void dependentPhases(const int entries, const float* a, float* b, float* c) {
+    @outer for (int j = 0; j < entries; j += 16) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            b[i] = a[i];
+        }
+    }
+    @outer for (int j = 0; j < entries; j += 16) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            c[i] = 2 * b[i];
+        }
+    }
+}
+
+// Statements between phases: separate parallel loops
+@kernel void splitPhases(const int entries, const float* a, float* b) {
+    @outer for (int j = 0; j < entries; j += 16) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            b[i] = a[i];
+        }
+    }
+    const int offset = 1;
+    @outer for (int j = 0; j < entries; j += 16) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            b[i] += offset;
+        }
+    }
+}
+
+// Write through a local pointer: barrier is kept
+@kernel void localPointerPhases(const int entries,
+                                const float* a @restrict,
+                                float* b @restrict,
+                                float* c @restrict) {
+    @outer for (int j = 0; j < entries; j += 16) {
+        float* row = b + j;
+        @inner for (int i = j; i < j + 16; ++i) {
+            row[i - j] = a[i];
+        }
+    }
+    @outer for (int j = 0; j < entries; j += 16) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            c[i] = 2 * b[i];
+        }
+    }
+}
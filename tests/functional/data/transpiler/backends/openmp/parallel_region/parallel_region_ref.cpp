@@ -0,0 +1,80 @@
+// Independent phases: barriers are skipped
+extern "C" void independentPhases(const int& entries,
+                                  const float* __restrict__ a,
+                                  float* __restrict__ b,
+                                  float* __restrict__ c) {
+#pragma omp parallel
+    {
+#pragma omp for nowait
+        for (int j = 0; j < entries; j += 16) {
+            for (int i = j; i < j + 16; ++i) {
+                b[i] = a[i];
+            }
+        }
+#pragma omp for
+        for (int j = 0; j < entries; j += 16) {
+            for (int i = j; i < j + 16; ++i) {
+                c[i] = 2 * a[i];
+            }
+        }
+    }
+}
+
+// Second phase reads what the first one writes: barrier is kept
+extern "C" void dependentPhases(const int& entries, const float* a, float* b, float* c) {
+#pragma omp parallel
+    {
+#pragma omp for
+        for (int j = 0; j < entries; j += 16) {
+            for (int i = j; i < j + 16; ++i) {
+                b[i] = a[i];
+            }
+        }
+#pragma omp for
+        for (int j = 0; j < entries; j += 16) {
+            for (int i = j; i < j + 16; ++i) {
+                c[i] = 2 * b[i];
+            }
+        }
+    }
+}
+
+// Statements between phases: separate parallel loops
+extern "C" void splitPhases(const int& entries, const float* a, float* b) {
+#pragma omp parallel for
+    for (int j = 0; j < entries; j += 16) {
+        for (int i = j; i < j + 16; ++i) {
+            b[i] = a[i];
+        }
+    }
+    const int offset = 1;
+#pragma omp parallel for
+    for (int j = 0; j < entries; j += 16) {
+        for (int i = j; i < j + 16; ++i) {
+            b[i] += offset;
+        }
+    }
+}
+
+// Write through a local pointer: barrier is kept
+extern "C" void localPointerPhases(const int& entries,
+                                   const float* __restrict__ a,
+                                   float* __restrict__ b,
+                                   float* __restrict__ c) {
+#pragma omp parallel
+    {
+#pragma omp for
+        for (int j = 0; j < entries; j += 16) {
+            float* row = b + j;
+            for (int i = j; i < j + 16; ++i) {
+                row[i - j] = a[i];
+            }
+        }
+#pragma omp for
+        for (int j = 0; j < entries; j += 16) {
+            for (int i = j; i < j + 16; ++i) {
+                c[i] = 2 * b[i];
+            }
+        }
+    }
+}
@@ -0,0 +1,27 @@
+@kernel void addVectors0(const int entries, const float* a, const float* b, float* ab) {
+    @outer for (int j = 0; j < entries; j += 16; @schedule(dynamic, 4)) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+}
+
+@kernel void addVectors1(const int entries, const float* a, const float* b, float* ab) {
+    @schedule(guided, proc_bind=spread, num_threads=8)
+    for (int i = 0; i < entries; ++i; @tile(4, @outer, @inner)) {
+        ab[i] = a[i] + b[i];
+    }
+}
+
+@kernel void addVectors2(const int entries, const float* a, const float* b, float* ab) {
+    @outer for (int j = 0; j < entries; j += 16; @schedule(static, chunk=2)) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+    @outer for (int j = 0; j < entries; j += 16) {
+        @inner for (int i = j; i < j + 16; ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+}
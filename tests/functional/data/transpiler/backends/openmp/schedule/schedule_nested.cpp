@@ -0,0 +1,9 @@
+@kernel void scale(const int n, float* y) {
+    @outer for (int i = 0; i < n; ++i) {
+        @outer for (int k = 0; k < n; ++k; @schedule(dynamic, 4)) {
+            @inner for (int j = 0; j < 32; ++j) {
+                y[(i * n + k) * 32 + j] = 0;
+            }
+        }
+    }
+}
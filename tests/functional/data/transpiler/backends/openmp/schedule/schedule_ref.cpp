@@ -0,0 +1,37 @@
+extern "C" void addVectors0(const int& entries, const float* a, const float* b, float* ab) {
+#pragma omp parallel for schedule(dynamic, 4)
+    for (int j = 0; j < entries; j += 16) {
+        for (int i = j; i < j + 16; ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+}
+
+extern "C" void addVectors1(const int& entries, const float* a, const float* b, float* ab) {
+#pragma omp parallel for schedule(guided) proc_bind(spread) num_threads(8)
+    for (int _occa_tiled_i = (0); _occa_tiled_i < entries; _occa_tiled_i += 4) {
+        for (int i = _occa_tiled_i; i < (_occa_tiled_i + 4); ++i) {
+            if (i < entries) {
+                ab[i] = a[i] + b[i];
+            }
+        }
+    }
+}
+
+extern "C" void addVectors2(const int& entries, const float* a, const float* b, float* ab) {
+#pragma omp parallel
+    {
+#pragma omp for schedule(static, 2)
+        for (int j = 0; j < entries; j += 16) {
+            for (int i = j; i < j + 16; ++i) {
+                ab[i] = a[i] + b[i];
+            }
+        }
+#pragma omp for
+        for (int j = 0; j < entries; j += 16) {
+            for (int i = j; i < j + 16; ++i) {
+                ab[i] = a[i] + b[i];
+            }
+        }
+    }
+}
@@ -0,0 +1,31 @@
+extern "C" void pipelined(const int& blocks, const float* a, float* out) {
+  for (int b = 0; b < blocks; ++b) {
+    float tile[64];
+    for (int t = 0; t < 16; ++t) {
+      for (int j = 0; j < 64; ++j) {
+        tile[j] = a[(b * 16 + t) * 64 + j];
+      }
+      for (int j = 0; j < 64; ++j) {
+        out[(b * 16 + t) * 64 + j] = tile[63 - j];
+      }
+    }
+  }
+}
+
+// Tile is used outside of the sequential loop, copies stay synchronous
+extern "C" void not_pipelined(const int& blocks, const float* a, float* out) {
+  for (int b = 0; b < blocks; ++b) {
+    float tile[64];
+    for (int t = 0; t < 16; ++t) {
+      for (int j = 0; j < 64; ++j) {
+        tile[j] = a[(b * 16 + t) * 64 + j];
+      }
+      for (int j = 0; j < 64; ++j) {
+        out[(b * 16 + t) * 64 + j] = tile[63 - j];
+      }
+    }
+    for (int j = 0; j < 64; ++j) {
+      out[b * 64 + j] += tile[j];
+    }
+  }
+}
@@ -0,0 +1,14 @@
+// `in` and `coef` are only read, `out` is written and `alias` escapes into a local pointer
+@kernel void read_only(const int n,
+                       float* in,
+                       const float* coef,
+                       float* out,
+                       float* alias,
+                       float* keep @norestrict) {
+    @outer for (int i = 0; i < n; ++i) {
+        @inner for (int j = 0; j < 64; ++j) {
+            float* row = alias + i * 64;
+            out[i * 64 + j] = in[i * 64 + j] * *(coef + j) + row[j] + keep[j];
+        }
+    }
+}
@@ -0,0 +1,14 @@
+// `in` and `coef` are only read, `out` is written and `alias` escapes into a local pointer
+extern "C" void read_only(const int& n,
+                          const float* __restrict__ in,
+                          const float* __restrict__ coef,
+                          float* out,
+                          float* alias,
+                          float* keep) {
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < 64; ++j) {
+            float* row = alias + i * 64;
+            out[i * 64 + j] = in[i * 64 + j] * *(coef + j) + row[j] + keep[j];
+        }
+    }
+}
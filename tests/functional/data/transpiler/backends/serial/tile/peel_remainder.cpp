@@ -0,0 +1,20 @@
+// Outer -> inner, peeled remainder
+@kernel void addVectors0(const int entries, const float* a, const float* b, float* ab) {
+    for (int i = 0; i < entries; ++i; @tile(4, @outer, @inner, check = true, peel = true)) {
+        ab[i] = a[i] + b[i];
+    }
+}
+
+// Outer -> inner, decremental, peeled remainder
+@kernel void addVectors1(const int entries, const float* a, const float* b, float* ab) {
+    for (int i = entries - 1; i >= 0; i -= 1; @tile(4, @outer, @inner, peel = true)) {
+        ab[i] = a[i] + b[i];
+    }
+}
+
+// Outer -> inner, no check, nothing to peel
+@kernel void addVectors2(const int entries, const float* a, const float* b, float* ab) {
+    for (int i = 0; i < entries; ++i; @tile(4, @outer, @inner, check = false, peel = true)) {
+        ab[i] = a[i] + b[i];
+    }
+}
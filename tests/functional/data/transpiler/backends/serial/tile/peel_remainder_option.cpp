@@ -0,0 +1,13 @@
+// Outer -> inner, remainder is peeled by the global option
+@kernel void addVectors0(const int entries, const float* a, const float* b, float* ab) {
+    for (int i = 0; i < entries; ++i; @tile(4, @outer, @inner)) {
+        ab[i] = a[i] + b[i];
+    }
+}
+
+// Outer -> inner, attribute overrides the global option
+@kernel void addVectors1(const int entries, const float* a, const float* b, float* ab) {
+    for (int i = 0; i < entries; ++i; @tile(4, @outer, @inner, peel = false)) {
+        ab[i] = a[i] + b[i];
+    }
+}
@@ -0,0 +1,47 @@
+// Outer -> inner, peeled remainder
+extern "C" void addVectors0(const int& entries, const float* a, const float* b, float* ab) {
+    {
+        const int _occa_tiled_i_rem = (0) + ((entries) - (0)) / (4) * (4);
+        if ((0) < (entries)) {
+            for (int i = _occa_tiled_i_rem; i < (_occa_tiled_i_rem + 4); ++i) {
+                if (i < entries) {
+                    ab[i] = a[i] + b[i];
+                }
+            }
+        }
+        for (int _occa_tiled_i = (0); _occa_tiled_i < _occa_tiled_i_rem; _occa_tiled_i += 4) {
+            for (int i = _occa_tiled_i; i < (_occa_tiled_i + 4); ++i) {
+                ab[i] = a[i] + b[i];
+            }
+        }
+    }
+}
+
+// Outer -> inner, decremental, peeled remainder
+extern "C" void addVectors1(const int& entries, const float* a, const float* b, float* ab) {
+    {
+        const int _occa_tiled_i_rem = (entries - 1) - ((entries - 1) - (0)) / ((4 * 1)) * ((4 * 1));
+        if ((entries - 1) >= (0)) {
+            for (int i = _occa_tiled_i_rem; i > (_occa_tiled_i_rem - 4); i -= 1) {
+                if (i >= 0) {
+                    ab[i] = a[i] + b[i];
+                }
+            }
+        }
+        for (int _occa_tiled_i = (entries - 1); _occa_tiled_i > _occa_tiled_i_rem;
+             _occa_tiled_i -= (4 * 1)) {
+            for (int i = _occa_tiled_i; i > (_occa_tiled_i - 4); i -= 1) {
+                ab[i] = a[i] + b[i];
+            }
+        }
+    }
+}
+
+// Outer -> inner, no check, nothing to peel
+extern "C" void addVectors2(const int& entries, const float* a, const float* b, float* ab) {
+    for (int _occa_tiled_i = (0); _occa_tiled_i < entries; _occa_tiled_i += 4) {
+        for (int i = _occa_tiled_i; i < (_occa_tiled_i + 4); ++i) {
+            ab[i] = a[i] + b[i];
+        }
+    }
+}
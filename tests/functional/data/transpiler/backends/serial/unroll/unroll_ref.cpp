@@ -0,0 +1,48 @@
+extern "C" void unrolled(const int& n, const float* a, float* out) {
+  for (int b = 0; b < n; ++b) {
+    for (int i = 0; i < 64; ++i) {
+      float sum = 0;
+#pragma GCC unroll 4
+      for (int k = 0; k < 16; ++k) {
+        sum += a[(b * 64 + i) * 16 + k];
+      }
+#pragma GCC unroll 4
+      for (int k = 0; k < 4; ++k) {
+        sum *= a[k];
+      }
+      {
+        {
+          int k = 0;
+          {
+            out[(b * 64 + i) * 3 + k] = sum + k;
+          }
+        }
+        {
+          int k = 1;
+          {
+            out[(b * 64 + i) * 3 + k] = sum + k;
+          }
+        }
+        {
+          int k = 2;
+          {
+            out[(b * 64 + i) * 3 + k] = sum + k;
+          }
+        }
+      }
+    }
+  }
+}
+
+// Loop variable is modified in the body, expansion falls back to the pragma
+extern "C" void not_expanded(const int& n, float* out) {
+  for (int b = 0; b < n; ++b) {
+    for (int i = 0; i < 64; ++i) {
+#pragma GCC unroll 8
+      for (int k = 0; k < 8; ++k) {
+        out[b * 64 + i] += k;
+        k += out[b * 64 + i] > 1;
+      }
+    }
+  }
+}
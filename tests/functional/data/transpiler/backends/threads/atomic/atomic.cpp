@@ -0,0 +1,18 @@
+@kernel void atomicOps(const int entries,
+                       const int* iVec,
+                       int* iSum,
+                       const float* fVec,
+                       float* fSum) {
+    @outer for (int j = 0; j < entries; ++j) {
+        @inner for (int i = 0; i < entries; ++i) {
+            @atomic* iSum += iVec[i];
+            @atomic* fSum -= fVec[i];
+            @atomic iSum[1] = iVec[i];
+            @atomic ++iSum[2];
+            @atomic {
+                iSum[3] ^= iVec[i];
+                fSum[1] *= fVec[i];
+            }
+        }
+    }
+}
@@ -0,0 +1,19 @@
+extern "C" void atomicOps(const int& entries,
+                          const int* iVec,
+                          int* iSum,
+                          const float* fVec,
+                          float* fSum) {
+    okl_threads::parallel_for<int>(0, entries, 1, [&](int j) {
+        for (int i = 0; i < entries; ++i) {
+            std::atomic_ref(*iSum).fetch_add(iVec[i]);
+            std::atomic_ref(*fSum).fetch_sub(fVec[i]);
+            std::atomic_ref(iSum[1]).store(iVec[i]);
+            std::atomic_ref(iSum[2]).fetch_add(1);
+            {
+                std::lock_guard<std::mutex> _occa_atomic_lock(okl_threads::atomic_mutex());
+                iSum[3] ^= iVec[i];
+                fSum[1] *= fVec[i];
+            }
+        }
+    });
+}
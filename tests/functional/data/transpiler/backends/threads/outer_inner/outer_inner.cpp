@@ -0,0 +1,50 @@
+const int offset = 1;
+
+// template<typename T>
+float add(float a, float b) {
+    return a + b + offset;
+}
+
+// Outer -> inner
+@kernel void addVectors0(const int entries, const float* a, const float* b, float* ab) {
+    @outer for (int j = 0; j < entries; ++j) {
+        @inner for (int i = 0; i < entries; ++i) {
+            ab[i] = add(a[i], b[i]);
+        }
+    }
+}
+
+// Outer -> inner decreasing non 1 increment
+@kernel void addVectors1(const int entries, const float* a, const float* b, float* ab) {
+    @outer for (int j = entries - 1; j >= 0; j -= 2) {
+        @inner for (int i = entries - 1; i >= 0; i -= 2) {
+            ab[i] = add(a[i], b[i]);
+        }
+    }
+}
+
+// Outer -> outer -> inner, only top level loop is dispatched to the pool
+@kernel void addVectors2(const int entries, const float* a, const float* b, float* ab) {
+    @outer for (int i = 0; i < entries; i++) {
+        @outer for (int j = 0; j < entries; j++) {
+            @inner for (int k = 0; k < entries; k++) {
+                ab[k] = add(a[i], b[j]);
+            }
+        }
+    }
+}
+
+// Inclusive bound and continue of the outlined body
+@kernel void addVectors3(const int entries, const float* a, const float* b, float* ab) {
+    @outer for (int j = 0; j <= entries; j += 4) {
+        if (j == 2) {
+            continue;
+        }
+        @inner for (int i = 0; i < entries; ++i) {
+            if (i == 1) {
+                continue;
+            }
+            ab[i] = add(a[i], b[j]);
+        }
+    }
+}
@@ -0,0 +1,27 @@
+const int offset = 1;
+
+// template<typename T>
+float add(float a, float b) {
+    return a + b + offset;
+}
+
+// Outer -> inner
+@kernel void addVectors0(const int entries, const float* a, const float* b, float* ab) {
+    for (int i = 0; i < entries; i += 1; @tile(4, @outer, @inner)) {
+        ab[i] = add(a[i], b[i]);
+    }
+}
+
+// Outer -> inner unary pre add, check=False
+@kernel void addVectors1(const int entries, const float* a, const float* b, float* ab) {
+    for (int i = 0; i < entries; ++i; @tile(4, @outer, @inner, check = false)) {
+        ab[i] = add(a[i], b[i]);
+    }
+}
+
+// Outer -> inner decreasing
+@kernel void addVectors2(const int entries, const float* a, const float* b, float* ab) {
+    for (int i = entries - 1; i >= 0; i -= 1; @tile(4, @outer, @inner)) {
+        ab[i] = add(a[i], b[i]);
+    }
+}
@@ -0,0 +1,37 @@
+const int offset = 1;
+
+// template<typename T>
+float add(float a, float b) {
+    return a + b + offset;
+}
+
+// Outer -> inner
+extern "C" void addVectors0(const int& entries, const float* a, const float* b, float* ab) {
+    okl_threads::parallel_for<int>((0), entries, (4 * 1), [&](int _occa_tiled_i) {
+        for (int i = _occa_tiled_i; i < (_occa_tiled_i + 4); i += 1) {
+            if (i < entries) {
+                ab[i] = add(a[i], b[i]);
+            }
+        }
+    });
+}
+
+// Outer -> inner unary pre add, check=False
+extern "C" void addVectors1(const int& entries, const float* a, const float* b, float* ab) {
+    okl_threads::parallel_for<int>((0), entries, 4, [&](int _occa_tiled_i) {
+        for (int i = _occa_tiled_i; i < (_occa_tiled_i + 4); ++i) {
+            ab[i] = add(a[i], b[i]);
+        }
+    });
+}
+
+// Outer -> inner decreasing
+extern "C" void addVectors2(const int& entries, const float* a, const float* b, float* ab) {
+    okl_threads::parallel_for_reverse<int>((entries - 1), (0) - 1, (4 * 1), [&](int _occa_tiled_i) {
+        for (int i = _occa_tiled_i; i > (_occa_tiled_i - 4); i -= 1) {
+            if (i >= 0) {
+                ab[i] = add(a[i], b[i]);
+            }
+        }
+    });
+}
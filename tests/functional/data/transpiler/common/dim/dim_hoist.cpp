@@ -0,0 +1,24 @@
+typedef float* grid_f @dim(16, 16, 16);
+
+// stencil, accesses share the index math
+@kernel void test_stencil(grid_f u, grid_f out) {
+    for (int z = 1; z < 15; ++z; @outer(0)) {
+        for (int y = 1; y < 15; ++y; @inner(1)) {
+            for (int x = 1; x < 15; ++x; @inner(0)) {
+                float lap = u(x - 1, y, z) + u(x + 1, y, z);
+                lap += u(x, y - 1, z) + u(x, y + 1, z);
+                lap += u(x, y, z - 1) + u(x, y, z + 1);
+                out(x, y, z) = lap - 6 * u(x, y, z);
+            }
+        }
+    }
+}
+
+// stencil, dimensions are kernel arguments
+@kernel void test_runtime_dims(const int nx, const int ny, float* m @dim(nx, ny)) {
+    for (int j = 1; j < ny - 1; ++j; @outer(0)) {
+        for (int i = 1; i < nx - 1; ++i; @inner(0)) {
+            m(i, j) = m(i, j - 1) + m(i, j + 1);
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#include <cuda_runtime.h>
+
+typedef float* grid_f;
+
+// stencil, accesses share the index math
+extern "C" __global__ __launch_bounds__(196) void _occa_test_stencil_0(grid_f u, grid_f out) {
+    {
+        int z = (1) + blockIdx.x;
+        {
+            int y = (1) + threadIdx.y;
+            {
+                int x = (1) + threadIdx.x;
+                const auto _occa_dim_x_0 = x + 16 * y + 256 * z;
+                float lap = u[_occa_dim_x_0 - 1] + u[_occa_dim_x_0 + 1];
+                lap += u[_occa_dim_x_0 - 16] + u[_occa_dim_x_0 + 16];
+                lap += u[_occa_dim_x_0 - 256] + u[_occa_dim_x_0 + 256];
+                out[_occa_dim_x_0] = lap - 6 * u[_occa_dim_x_0];
+            }
+        }
+    }
+}
+
+// stencil, dimensions are kernel arguments
+extern "C" __global__ void _occa_test_runtime_dims_0(const int nx, const int ny, float* m) {
+    {
+        int j = (1) + blockIdx.x;
+        {
+            int i = (1) + threadIdx.x;
+            const auto _occa_dim_i_0 = i + nx * j;
+            m[_occa_dim_i_0] = m[_occa_dim_i_0 - nx] + m[_occa_dim_i_0 + nx];
+        }
+    }
+}
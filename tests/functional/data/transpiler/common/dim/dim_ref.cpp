@@ -20,7 +20,8 @@ extern "C" __global__ void _occa_test_kernel_0_0(const int entries,
         int i = (0) + ((1) * blockIdx.x);
         {
             int j = (0) + ((1) * threadIdx.x);
-            ab[i] = a[i] + b[j] + mat[i + (8 * (j))];
+            const auto _occa_dim_j_0 = i + 8 * j;
+            ab[i] = a[i] + b[j] + mat[_occa_dim_j_0];
         }
     }
 }
@@ -35,7 +36,8 @@ extern "C" __global__ void _occa_test_kernel_1_0(const int entries,
         int i = (0) + ((1) * blockIdx.x);
         {
             int j = (0) + ((1) * threadIdx.x);
-            ab[i] = a[i] + b[j] + static_cast<float>(mat[i + (8 * (j))]);
+            const auto _occa_dim_j_0 = i + 8 * j;
+            ab[i] = a[i] + b[j] + static_cast<float>(mat[_occa_dim_j_0]);
         }
     }
 }
@@ -50,7 +52,8 @@ extern "C" __global__ void _occa_test_kernel_2_0(const int entries,
         int i = (0) + ((1) * blockIdx.x);
         {
             int j = (0) + ((1) * threadIdx.x);
-            ab[i] = a[i] + b[j] + mat[i + (8 * (j))].x;
+            const auto _occa_dim_j_0 = i + 8 * j;
+            ab[i] = a[i] + b[j] + mat[_occa_dim_j_0].x;
         }
     }
 }
@@ -80,7 +83,9 @@ extern "C" __global__ void _occa_test_kernel_4_0(const int entries,
         int i = (mat[7 + (8 * (7))]) + ((mat[1 + (8 * (1))]) * blockIdx.x);
         {
             int j = (mat[0 + (8 * (0))]) + ((1) * threadIdx.x);
-            ab[i] = a[i] + b[j] + mat[i + (8 * (j))].x + mat[j + (8 * (i))].y;
+            const auto _occa_dim_j_0 = i + 8 * j;
+            const auto _occa_dim_j_1 = j + 8 * i;
+            ab[i] = a[i] + b[j] + mat[_occa_dim_j_0].x + mat[_occa_dim_j_1].y;
         }
     }
 }
@@ -103,8 +108,10 @@ extern "C" __global__ void _occa_test_kernel_5_0(const int entries,
         int i = (0) + ((1) * blockIdx.x);
         {
             int j = (0) + ((1) * threadIdx.x);
-            if (mat[i + (8 * (j))].x <= 0) {
-                mat[i + (8 * (j))].x = a[i] + b[j] + mat[i + (8 * (j))].x + mat[j + (8 * (i))].y;
+            const auto _occa_dim_j_0 = i + 8 * j;
+            const auto _occa_dim_j_1 = j + 8 * i;
+            if (mat[_occa_dim_j_0].x <= 0) {
+                mat[_occa_dim_j_0].x = a[i] + b[j] + mat[_occa_dim_j_0].x + mat[_occa_dim_j_1].y;
             }
         }
     }
@@ -120,7 +127,8 @@ extern "C" __global__ void _occa_test_kernel_6_0(const int entries,
         int i = (0) + ((1) * blockIdx.x);
         {
             int j = (0) + ((1) * threadIdx.x);
-            mat[i + (8 * (j))] = a[i] + b[j] + mat[i + (8 * (mat[j + (8 * (0))]))];
+            const auto _occa_dim_j_0 = i + 8 * j;
+            mat[_occa_dim_j_0] = a[i] + b[j] + mat[i + (8 * (mat[j + (8 * (0))]))];
         }
     }
 }
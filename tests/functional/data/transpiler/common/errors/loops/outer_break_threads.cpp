@@ -0,0 +1,10 @@
+@kernel void hello_kern(const int n, float* out) {
+    @outer for (int i = 0; i < n; ++i) {
+        if (i > 32) {
+            break;
+        }
+        @inner for (int j = 0; j < 10; ++j) {
+            out[i * 10 + j] = j;
+        }
+    }
+}
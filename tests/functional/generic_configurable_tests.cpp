@@ -1,4 +1,5 @@
 #include "common/data_directory.h"
+#include "common/isolated_case.h"
 #include "common/load_test_suites.h"
 
 #include <oklt/core/error.h>
@@ -14,6 +15,8 @@
 #include <spdlog/fmt/fmt.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 
 using json = nlohmann::json;
@@ -21,7 +24,7 @@ namespace fs = std::filesystem;
 using namespace oklt::tests;
 
 enum struct Action { NORMALIZER, TRANSPILER, NORMALIZE_AND_TRANSPILE };
-enum struct Compare { SOURCE, METADATA, ERROR_MESSAGE };
+enum struct Compare { SOURCE, SOURCE_TAIL, METADATA, ERROR_MESSAGE, WARNINGS };
 
 std::string toLower(const std::string& str) {
     std::string result;
@@ -64,8 +67,10 @@ tl::expected<Action, std::string> buildActionFrom(const std::string& v) {
 tl::expected<Compare, std::string> buildCompareFrom(const std::string& v) {
     static const std::map<std::string, Compare> compares = {
         {"source", Compare::SOURCE},
+        {"source_tail", Compare::SOURCE_TAIL},
         {"metadata", Compare::METADATA},
         {"error_message", Compare::ERROR_MESSAGE},
+        {"warnings", Compare::WARNINGS},
     };
     auto it = compares.find(toLower(v));
     if (it != compares.cend()) {
@@ -93,10 +98,65 @@ struct TranspileActionConfig {
     std::vector<std::filesystem::path> mutable includes;
     std::vector<std::string> mutable defs;
     std::filesystem::path launcher;
+    json options = json::object();  // INFO: optional, read separately from the rest of the fields
     NLOHMANN_DEFINE_TYPE_INTRUSIVE(TranspileActionConfig, backend, source, includes, defs, launcher)
     oklt::UserInput build(const fs::path& dataDir) const;
 };
 
+TranspileActionConfig getTranspileActionConfig(const json& actionConfig) {
+    auto conf = actionConfig.get<TranspileActionConfig>();
+    conf.options = actionConfig.value("options", json::object());
+    return conf;
+}
+
+void applyUserOptions(oklt::UserInput& input, const json& options) {
+    if (options.contains("omp_schedule")) {
+        options.at("omp_schedule").get_to(input.ompSchedule);
+    }
+    if (options.contains("peel_tile_remainder")) {
+        options.at("peel_tile_remainder").get_to(input.peelTileRemainder);
+    }
+    if (options.contains("numa_partition")) {
+        options.at("numa_partition").get_to(input.numaPartition);
+    }
+    if (options.contains("dynamic_shared")) {
+        options.at("dynamic_shared").get_to(input.dynamicShared);
+    }
+    if (options.contains("infer_read_only_args")) {
+        options.at("infer_read_only_args").get_to(input.inferReadOnlyArgs);
+    }
+    if (options.contains("reduce_uniform_atomics")) {
+        options.at("reduce_uniform_atomics").get_to(input.reduceUniformAtomics);
+    }
+    if (options.contains("local_accessor_shared")) {
+        options.at("local_accessor_shared").get_to(input.localAccessorShared);
+    }
+    if (options.contains("pad_shared_banks")) {
+        options.at("pad_shared_banks").get_to(input.padSharedBanks);
+    }
+    if (options.contains("analyze_coalescing")) {
+        options.at("analyze_coalescing").get_to(input.analyzeCoalescing);
+    }
+    if (options.contains("fuse_outer_loops")) {
+        options.at("fuse_outer_loops").get_to(input.fuseOuterLoops);
+    }
+    if (options.contains("constant_args")) {
+        options.at("constant_args").get_to(input.constantArgs);
+    }
+    if (options.contains("drop_constant_args")) {
+        options.at("drop_constant_args").get_to(input.dropConstantArgs);
+    }
+    if (options.contains("tuning_grid")) {
+        options.at("tuning_grid").get_to(input.tuningGrid);
+    }
+    if (options.contains("wavefront_size")) {
+        options.at("wavefront_size").get_to(input.wavefrontSize);
+    }
+    if (options.contains("eliminate_dead_decls")) {
+        options.at("eliminate_dead_decls").get_to(input.eliminateDeadDecls);
+    }
+}
+
 oklt::UserInput TranspileActionConfig::build(const fs::path& dataDir) const {
     auto expectedBackend = oklt::backendFromString(backend);
     if (!expectedBackend) {
@@ -110,11 +170,13 @@ oklt::UserInput TranspileActionConfig::build(const fs::path& dataDir) const {
     std::ifstream sourceFile{sourceFullPath};
     std::string sourceCode{std::istreambuf_iterator<char>(sourceFile), {}};
 
-    return oklt::UserInput{.backend = expectedBackend.value(),
-                           .source = std::move(sourceCode),
-                           .sourcePath = std::move(sourceFullPath),
-                           .includeDirectories = includes,
-                           .defines = defs};
+    auto input = oklt::UserInput{.backend = expectedBackend.value(),
+                                 .source = std::move(sourceCode),
+                                 .sourcePath = std::move(sourceFullPath),
+                                 .includeDirectories = includes,
+                                 .defines = defs};
+    applyUserOptions(input, options);
+    return input;
 }
 
 namespace {
@@ -139,6 +201,81 @@ void compareError(const std::string& sourceFilePath,
     EXPECT_EQ(errorMessage, refErrorMessage)
         << "Error message is different for file: " << sourceFilePath;
 }
+
+// Reference is the end of the source, e.g. kernels without the runtime embedded before them
+void compareSourceTail(const fs::path& referencePath,
+                       const std::string& reference,
+                       const std::string& source) {
+    std::string formatedReference = oklt::format(reference);
+    std::string formatedSource = oklt::format(source);
+    auto tailSize = std::min(formatedReference.size(), formatedSource.size());
+    EXPECT_EQ(formatedReference, formatedSource.substr(formatedSource.size() - tailSize))
+        << fmt::format("Failed compare {} with the end of generated source",
+                       referencePath.string());
+}
+
+// All warnings are compared to the whole file, in the order they are reported
+void compareWarnings(const std::string& sourceFilePath,
+                     const oklt::UserResult& res,
+                     const std::string& refWarnings) {
+    ASSERT_TRUE(res.has_value()) << "Warnings are expected without errors: " << sourceFilePath;
+
+    // Path to file in warning message depends on pwd the same way as in error message
+    auto filename = fs::path(sourceFilePath).filename().string();
+    std::string warnings;
+    for (const auto& warning : res.value().warnings) {
+        auto message = warning.desc;
+        if (message.find(sourceFilePath) == 0) {
+            message.replace(0, sourceFilePath.size(), filename);
+        }
+        warnings += message;
+    }
+
+    EXPECT_EQ(warnings, refWarnings) << "Warnings are different for file: " << sourceFilePath;
+}
+
+// Output must be bit-identical on every run, since it keys compile caches downstream. Every repeat
+// runs in a process of its own, so that the address space layout differs between the runs
+void compareRepeated(const fs::path& suitePath,
+                     size_t caseIndex,
+                     const std::string& sourceFilePath,
+                     const oklt::UserResult& res,
+                     size_t repeat) {
+    if (!res) {
+        return;
+    }
+    const auto& holder = DataRootHolder::instance();
+    for (size_t i = 1; i < repeat; ++i) {
+        auto outputName = fmt::format(
+            "occa-transpiler-tests-{}-{}-{}.json", suitePath.stem().string(), caseIndex, i);
+        auto outputPath = fs::temp_directory_path() / outputName;
+        auto command = fmt::format(
+            "\"{}\" -s \"{}\" -d \"{}\" --isolated_suite \"{}\" --isolated_case {} "
+            "--isolated_output \"{}\"",
+            holder.executable.string(),
+            holder.suitePath.string(),
+            holder.dataRoot.string(),
+            suitePath.string(),
+            caseIndex,
+            outputPath.string());
+        auto status = std::system(command.c_str());
+        std::ifstream outputFile(outputPath);
+        auto other = json::parse(outputFile, nullptr, false);
+        outputFile.close();
+        fs::remove(outputPath);
+        ASSERT_TRUE(status == 0 && other.is_object())
+            << "Repeated transpilation failed on run " << i << ": " << sourceFilePath;
+
+        EXPECT_EQ(res->kernel.source, other.value("kernel_source", ""))
+            << "Kernel source differs on run " << i << ": " << sourceFilePath;
+        EXPECT_EQ(res->kernel.metadata, other.value("kernel_metadata", ""))
+            << "Kernel metadata differs on run " << i << ": " << sourceFilePath;
+        EXPECT_EQ(res->launcher.source, other.value("launcher_source", ""))
+            << "Launcher source differs on run " << i << ": " << sourceFilePath;
+        EXPECT_EQ(res->launcher.metadata, other.value("launcher_metadata", ""))
+            << "Launcher metadata differs on run " << i << ": " << sourceFilePath;
+    }
+}
 }  // namespace
 
 class GenericTest : public testing::TestWithParam<std::string> {};
@@ -149,7 +286,8 @@ TEST_P(GenericTest, OCCATests) {
     std::ifstream testSuitFile(suitPath);
     json tests = json::parse(testSuitFile);
 
-    for (const auto& testCase : tests) {
+    for (size_t caseIndex = 0; caseIndex < tests.size(); ++caseIndex) {
+        const auto& testCase = tests[caseIndex];
         auto it = testCase.find("action");
         if (it == testCase.cend()) {
             GTEST_SKIP_("Can't get action field");
@@ -170,6 +308,9 @@ TEST_P(GenericTest, OCCATests) {
             cmp = expectedCmp.value();
         }
 
+        // INFO: optional, transpile the same input several times and compare all outputs
+        auto repeat = testCase.value("repeat", size_t(1));
+
         auto referencePath = testCase["reference"].get<std::filesystem::path>();
         referencePath = dataDir / referencePath;
 
@@ -201,6 +342,11 @@ TEST_P(GenericTest, OCCATests) {
                                            referencePath.string());
                         break;
                     }
+                    case Compare::SOURCE_TAIL: {
+                        compareSourceTail(
+                            referencePath, reference, normalizeResult.value().normalized.source);
+                        break;
+                    }
                     case Compare::METADATA: {
                         break;
                     }
@@ -208,6 +354,10 @@ TEST_P(GenericTest, OCCATests) {
                         compareError(input.sourcePath, normalizeResult, reference);
                         break;
                     }
+                    case Compare::WARNINGS: {
+                        compareWarnings(input.sourcePath, normalizeResult, reference);
+                        break;
+                    }
                 }
 
             } break;
@@ -217,10 +367,11 @@ TEST_P(GenericTest, OCCATests) {
                     GTEST_SKIP_("Can't get action_config field");
                     continue;
                 }
-                auto conf = actionConfig->get<TranspileActionConfig>();
+                auto conf = getTranspileActionConfig(*actionConfig);
                 auto input = conf.build(dataDir);
                 SPDLOG_INFO("Run Transpile action for {}", input.sourcePath.string());
                 auto transpileResult = oklt::transpile(input);
+                compareRepeated(suitPath, caseIndex, input.sourcePath, transpileResult, repeat);
 
                 if (!transpileResult && cmp != Compare::ERROR_MESSAGE) {
                     std::string error;
@@ -244,6 +395,11 @@ TEST_P(GenericTest, OCCATests) {
 
                         break;
                     }
+                    case Compare::SOURCE_TAIL: {
+                        compareSourceTail(
+                            referencePath, reference, transpileResult.value().kernel.source);
+                        break;
+                    }
                     case Compare::METADATA: {
                         EXPECT_EQ(reference, transpileResult.value().kernel.metadata)
                             << fmt::format("Failed compare {} with generated kernel metadataJson",
@@ -255,6 +411,10 @@ TEST_P(GenericTest, OCCATests) {
                         compareError(input.sourcePath, transpileResult, reference);
                         break;
                     }
+                    case Compare::WARNINGS: {
+                        compareWarnings(input.sourcePath, transpileResult, reference);
+                        break;
+                    }
                 }
 
             } break;
@@ -264,10 +424,11 @@ TEST_P(GenericTest, OCCATests) {
                     GTEST_SKIP_("Can't get action_config field");
                     continue;
                 }
-                auto conf = actionConfig->get<TranspileActionConfig>();
+                auto conf = getTranspileActionConfig(*actionConfig);
                 auto input = conf.build(dataDir);
                 SPDLOG_INFO("Run Normalize and Transpile action for {}", input.sourcePath.string());
                 auto transpileResult = oklt::normalizeAndTranspile(input);
+                compareRepeated(suitPath, caseIndex, input.sourcePath, transpileResult, repeat);
 
                 if (!transpileResult && cmp != Compare::ERROR_MESSAGE) {
                     std::string error;
@@ -290,6 +451,11 @@ TEST_P(GenericTest, OCCATests) {
                             referencePath.string());
                         break;
                     }
+                    case Compare::SOURCE_TAIL: {
+                        compareSourceTail(
+                            referencePath, reference, transpileResult.value().kernel.source);
+                        break;
+                    }
                     case Compare::METADATA: {
                         EXPECT_EQ(reference, transpileResult.value().kernel.metadata)
                             << fmt::format("Failed compare {} with generated kernel metadataJson",
@@ -301,6 +467,10 @@ TEST_P(GenericTest, OCCATests) {
                         compareError(input.sourcePath, transpileResult, reference);
                         break;
                     }
+                    case Compare::WARNINGS: {
+                        compareWarnings(input.sourcePath, transpileResult, reference);
+                        break;
+                    }
                 }
                 break;
             }
@@ -308,6 +478,37 @@ TEST_P(GenericTest, OCCATests) {
     }
 }
 
+namespace oklt::tests {
+int runIsolatedCase(const fs::path& suite, size_t index, const fs::path& output) {
+    std::ifstream suiteFile(suite);
+    json tests = json::parse(suiteFile, nullptr, false);
+    if (!tests.is_array() || index >= tests.size()) {
+        return 1;
+    }
+    const auto& testCase = tests[index];
+    auto action = buildActionFrom(testCase.value("action", ""));
+    auto actionConfig = testCase.find("action_config");
+    if (!action || *action == Action::NORMALIZER || actionConfig == testCase.cend()) {
+        return 1;
+    }
+
+    auto input = getTranspileActionConfig(*actionConfig).build(DataRootHolder::instance().dataRoot);
+    auto result = *action == Action::TRANSPILER ? oklt::transpile(input)
+                                                : oklt::normalizeAndTranspile(input);
+    if (!result) {
+        return 1;
+    }
+
+    json dump = {{"kernel_source", result->kernel.source},
+                 {"kernel_metadata", result->kernel.metadata},
+                 {"launcher_source", result->launcher.source},
+                 {"launcher_metadata", result->launcher.metadata}};
+    std::ofstream outputFile(output);
+    outputFile << dump.dump();
+    return outputFile.good() ? 0 : 1;
+}
+}  // namespace oklt::tests
+
 struct GenericConfigTestNamePrinter {
     std::string operator()(const testing::TestParamInfo<std::string>& info) const {
         std::filesystem::path fullPath(info.param);
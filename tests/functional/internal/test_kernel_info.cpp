@@ -116,3 +116,36 @@ TEST(TestKernelInfo, KernelInfoJsonTest) {
     EXPECT_TRUE(info.props.has_value());
     EXPECT_EQ(std::string("nvcc"), info.props.value().compiler);
 }
+
+TEST(TestKernelInfo, ScheduleInfoJsonTest) {
+    auto dataDir = DataRootHolder::instance().dataRoot;
+    auto miscDir = dataDir / "misc";
+    auto scheduleJsonPath = miscDir / "schedule_info.json";
+    std::ifstream scheduleJsonFile(scheduleJsonPath);
+    json tests = json::parse(scheduleJsonFile);
+
+    std::vector<ScheduleInfo> deserialized;
+    for (const auto& obj : tests) {
+        ScheduleInfo schedule;
+        obj.get_to(schedule);
+        deserialized.emplace_back(std::move(schedule));
+    }
+    EXPECT_EQ(3, deserialized.size()) << "Test contains different amount of entries";
+
+    EXPECT_TRUE(deserialized[0].empty());
+
+    EXPECT_EQ(ScheduleKind::Dynamic, deserialized[1].kind);
+    EXPECT_EQ(4, deserialized[1].chunk);
+    EXPECT_EQ(ProcBind::Default, deserialized[1].procBind);
+    EXPECT_EQ(-1, deserialized[1].numThreads);
+
+    EXPECT_EQ(ScheduleKind::Guided, deserialized[2].kind);
+    EXPECT_EQ(-1, deserialized[2].chunk);
+    EXPECT_EQ(ProcBind::Spread, deserialized[2].procBind);
+    EXPECT_EQ(8, deserialized[2].numThreads);
+
+    std::string originFormatedJson = tests.dump();
+    json testedJson(deserialized);
+    std::string testedFormatedJson = testedJson.dump();
+    EXPECT_EQ(originFormatedJson, testedFormatedJson);
+}
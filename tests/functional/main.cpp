@@ -2,6 +2,7 @@
 #include <argparse/argparse.hpp>
 #include <iostream>
 #include "common/data_directory.h"
+#include "common/isolated_case.h"
 
 namespace fs = std::filesystem;
 using namespace oklt::tests;
@@ -18,6 +19,11 @@ int main(int argc, char* argv[]) {
     program.add_argument("-d", "--data_root")
         .default_value(defaultData.string())
         .help("set data root folder");
+    program.add_argument("--isolated_suite")
+        .default_value(std::string())
+        .help("transpile one case of the suite file and exit, used by repeated runs");
+    program.add_argument("--isolated_case").default_value(std::string("0")).help("case index");
+    program.add_argument("--isolated_output").default_value(std::string()).help("output file");
 
     try {
         program.parse_known_args(argc, argv);
@@ -35,6 +41,17 @@ int main(int argc, char* argv[]) {
             return 1;
         }
         DataRootHolder::instance().dataRoot = p;
+
+        std::error_code ec;
+        auto executable = fs::read_symlink("/proc/self/exe", ec);
+        DataRootHolder::instance().executable = ec ? fs::absolute(argv[0]) : executable;
+
+        auto isolatedSuite = program.get<std::string>("--isolated_suite");
+        if (!isolatedSuite.empty()) {
+            return runIsolatedCase(isolatedSuite,
+                                   std::stoul(program.get<std::string>("--isolated_case")),
+                                   program.get<std::string>("--isolated_output"));
+        }
     } catch (const std::exception& err) {
         std::cerr << "Tests config error: " << err.what() << std::endl;
         std::cerr << program.usage() << std::endl;
@@ -58,7 +58,7 @@ int main(int argc, char* argv[]) {
     transpile_command.add_argument("-b", "--backend")
         .required()
         //.choices("cuda", "openmp")
-        .help("backends: {serial, openmp, cuda, hip, dpcpp}");
+        .help("backends: {serial, openmp, threads, cuda, hip, dpcpp}");
     transpile_command.add_argument("-i", "--input").required().help("input file");
     transpile_command.add_argument("--normalize")
         .flag()